@@ -0,0 +1,190 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#ifndef _COMMON_FLATCACHE_H_
+#define _COMMON_FLATCACHE_H_
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace fcitx {
+
+// Fixed capacity cache, all the storage is allocated upon construction.
+//
+// Entries are kept in a flat array and indexed by an open addressing hash
+// table with linear probing, so each key is only stored once. When the cache
+// is full, the entry to evict is chosen by the CLOCK algorithm, which
+// approximates LRU without reordering anything on lookup.
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+class FlatCache {
+public:
+    using key_type = K;
+    using value_type = V;
+
+    explicit FlatCache(size_t capacity = 80)
+        : capacity_(std::max<size_t>(capacity, 1)),
+          // Keep load factor under 0.5.
+          mask_(std::bit_ceil(capacity_ * 2) - 1), slots_(capacity_),
+          buckets_(mask_ + 1) {
+        free_.reserve(capacity_);
+        clear();
+    }
+
+    size_t size() const { return size_; }
+
+    size_t capacity() const { return capacity_; }
+
+    bool empty() const { return size_ == 0; }
+
+    bool contains(const key_type &key) const {
+        return findBucket(key, hash(key)) != npos;
+    }
+
+    // Return nullptr if key already exists, same as LRUCache.
+    template <typename... Args>
+    value_type *insert(const key_type &key, Args &&...args) {
+        const auto h = hash(key);
+        if (findBucket(key, h) != npos) {
+            return nullptr;
+        }
+        const auto index = allocate();
+        auto &slot = slots_[index];
+        slot.item.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+        slot.hash = h;
+        slot.referenced = false;
+
+        auto pos = h & mask_;
+        while (buckets_[pos] != Empty) {
+            pos = (pos + 1) & mask_;
+        }
+        buckets_[pos] = index;
+        size_ += 1;
+        return &slot.item->second;
+    }
+
+    void erase(const key_type &key) {
+        auto pos = findBucket(key, hash(key));
+        if (pos == npos) {
+            return;
+        }
+        auto index = buckets_[pos];
+        eraseBucket(pos);
+        slots_[index].item.reset();
+        free_.push_back(index);
+        size_ -= 1;
+    }
+
+    value_type *find(const key_type &key) {
+        auto pos = findBucket(key, hash(key));
+        if (pos == npos) {
+            return nullptr;
+        }
+        auto &slot = slots_[buckets_[pos]];
+        slot.referenced = true;
+        return &slot.item->second;
+    }
+
+    void clear() {
+        for (auto &slot : slots_) {
+            slot.item.reset();
+        }
+        std::fill(buckets_.begin(), buckets_.end(), Empty);
+        free_.clear();
+        for (size_t i = capacity_; i > 0; i--) {
+            free_.push_back(static_cast<uint32_t>(i - 1));
+        }
+        size_ = 0;
+        hand_ = 0;
+    }
+
+private:
+    static constexpr uint32_t Empty = std::numeric_limits<uint32_t>::max();
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    struct Slot {
+        std::optional<std::pair<key_type, value_type>> item;
+        uint32_t hash = 0;
+        bool referenced = false;
+    };
+
+    uint32_t hash(const key_type &key) const {
+        // Only lower bits are used for indexing, mix the upper bits in.
+        auto h = static_cast<uint64_t>(hasher_(key));
+        return static_cast<uint32_t>(h ^ (h >> 32));
+    }
+
+    size_t findBucket(const key_type &key, uint32_t h) const {
+        for (auto pos = h & mask_; buckets_[pos] != Empty;
+             pos = (pos + 1) & mask_) {
+            const auto &slot = slots_[buckets_[pos]];
+            if (slot.hash == h && equal_(slot.item->first, key)) {
+                return pos;
+            }
+        }
+        return npos;
+    }
+
+    // Return a free slot, evict one if necessary.
+    uint32_t allocate() {
+        if (!free_.empty()) {
+            auto index = free_.back();
+            free_.pop_back();
+            return index;
+        }
+        // Give referenced entries a second chance.
+        while (slots_[hand_].referenced) {
+            slots_[hand_].referenced = false;
+            hand_ = (hand_ + 1) % capacity_;
+        }
+        auto index = static_cast<uint32_t>(hand_);
+        hand_ = (hand_ + 1) % capacity_;
+        auto &slot = slots_[index];
+        eraseBucket(findBucket(slot.item->first, slot.hash));
+        slot.item.reset();
+        size_ -= 1;
+        return index;
+    }
+
+    // Backward shift deletion, so no tombstone is needed.
+    void eraseBucket(size_t pos) {
+        auto next = (pos + 1) & mask_;
+        while (buckets_[next] != Empty) {
+            auto ideal = slots_[buckets_[next]].hash & mask_;
+            // Entry can be moved to pos only if its ideal bucket is not in
+            // (pos, next].
+            if (((next - ideal) & mask_) >= ((next - pos) & mask_)) {
+                buckets_[pos] = buckets_[next];
+                pos = next;
+            }
+            next = (next + 1) & mask_;
+        }
+        buckets_[pos] = Empty;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> buckets_;
+    std::vector<uint32_t> free_;
+    size_t size_ = 0;
+    size_t hand_ = 0;
+    [[no_unique_address]] Hash hasher_;
+    [[no_unique_address]] KeyEqual equal_;
+};
+
+} // namespace fcitx
+
+#endif // _COMMON_FLATCACHE_H_
@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#ifndef _COMMON_MAPPEDFILE_H_
+#define _COMMON_MAPPEDFILE_H_
+
+#include <cerrno>
+#include <cstddef>
+#include <fcntl.h>
+#include <ios>
+#include <istream>
+#include <memory>
+#include <span>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace fcitx {
+
+// Read only view of a whole file. Large files are mapped privately so the
+// content is served from page cache directly, small ones, or the ones not
+// allowed to be mapped, are read into memory with pread.
+//
+// Accessing a mapping after the file is truncated raises SIGBUS, and
+// MAP_PRIVATE does not prevent it, nor hide other changes to the pages that
+// are not written. Files saved with StandardPath::safeSave are replaced by
+// rename, which keeps the mapped inode intact. Files that might be modified in
+// place, e.g. the ones copied by user, should be read with mayMap = false.
+class MappedFile {
+public:
+    // Files smaller than this are read into memory, where mapping does not
+    // save much.
+    static constexpr size_t MinMapSize = 1024 * 1024;
+
+    MappedFile() = default;
+    explicit MappedFile(const std::string &path, bool mayMap = true) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return;
+        }
+        map(fd, mayMap);
+        ::close(fd);
+    }
+    // Map the file referred by fd, fd can be closed afterwards.
+    explicit MappedFile(int fd, bool mayMap = true) { map(fd, mayMap); }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          mtime_(std::exchange(other.mtime_, {})),
+          buffer_(std::move(other.buffer_)) {}
+    MappedFile &operator=(MappedFile &&other) noexcept {
+        if (this != &other) {
+            reset();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            mtime_ = std::exchange(other.mtime_, {});
+            buffer_ = std::move(other.buffer_);
+        }
+        return *this;
+    }
+    ~MappedFile() { reset(); }
+
+    bool isValid() const { return data_ != nullptr; }
+    const char *data() const { return static_cast<const char *>(data_); }
+    size_t size() const { return size_; }
+    std::span<const char> span() const { return {data(), size_}; }
+    std::string_view view() const { return {data(), size_}; }
+    // Modification time of the file when it is mapped.
+    const struct timespec &mtime() const { return mtime_; }
+
+    // Hint kernel that file will be read sequentially, e.g. when it is going
+    // to be parsed once.
+    void adviseSequential() const {
+        if (data_ && !buffer_) {
+            ::madvise(data_, size_, MADV_SEQUENTIAL);
+        }
+    }
+
+    void reset() {
+        if (data_ && !buffer_) {
+            ::munmap(data_, size_);
+        }
+        buffer_.reset();
+        data_ = nullptr;
+        size_ = 0;
+        mtime_ = {};
+    }
+
+private:
+    void map(int fd, bool mayMap) {
+        struct stat st;
+        if (fd < 0 || ::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) ||
+            st.st_size <= 0) {
+            return;
+        }
+        const size_t size = st.st_size;
+        if (!mayMap || size < MinMapSize) {
+            auto buffer = std::make_unique<char[]>(size);
+            size_t offset = 0;
+            while (offset < size) {
+                auto n = ::pread(fd, buffer.get() + offset, size - offset,
+                                 offset);
+                if (n < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (n <= 0) {
+                    return;
+                }
+                offset += n;
+            }
+            buffer_ = std::move(buffer);
+            data_ = buffer_.get();
+        } else {
+            void *data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                return;
+            }
+            data_ = data;
+        }
+        size_ = size;
+        mtime_ = st.st_mtim;
+    }
+
+    void *data_ = nullptr;
+    size_t size_ = 0;
+    struct timespec mtime_ = {};
+    // Owns the content if the file is read instead of mapped.
+    std::unique_ptr<char[]> buffer_;
+};
+
+// A std::streambuf that reads from memory mapped file without copying.
+class MappedFileStreamBuf : public std::streambuf {
+public:
+    explicit MappedFileStreamBuf(const MappedFile &file)
+        : MappedFileStreamBuf(file.view()) {}
+    // Read from a part of the mapped file.
+    explicit MappedFileStreamBuf(std::string_view data) {
+        // streambuf only takes non-const pointer, but get area is never
+        // written.
+        auto *begin = const_cast<char *>(data.data());
+        setg(begin, begin, begin + data.size());
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        off_type base = 0;
+        if (dir == std::ios_base::cur) {
+            base = gptr() - eback();
+        } else if (dir == std::ios_base::end) {
+            base = egptr() - eback();
+        }
+        return seekpos(pos_type(base + off), which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in) || pos < 0 ||
+            pos > egptr() - eback()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + pos, egptr());
+        return pos;
+    }
+};
+
+} // namespace fcitx
+
+#endif // _COMMON_MAPPEDFILE_H_
@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#ifndef _COMMON_SNAPSHOTSAVER_H_
+#define _COMMON_SNAPSHOTSAVER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <fcntl.h>
+#include <fcitx-utils/fs.h>
+#include <fcitx-utils/standardpaths.h>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fcitx {
+
+// Save user data, e.g. user dictionary and history, to PkgData without
+// blocking the main thread on disk I/O.
+//
+// Dictionaries can't be copied cheaply, so the snapshot is taken by
+// serializing them into memory. The serialized data is never changed
+// afterwards, and can be written and synced by another thread. A file is
+// skipped if its content is the same as the last one written by the saver,
+// and the file on disk is still the one written.
+class SnapshotSaver {
+public:
+    enum class OnFailure {
+        // Later files depend on the earlier ones, e.g. a journal tied to
+        // them.
+        Stop,
+        // Files are independent from each other.
+        Continue,
+    };
+
+    class Snapshot {
+    public:
+        // Serialize the content of path, path is not added if serializer
+        // returns false.
+        bool add(std::string path,
+                 const std::function<bool(std::ostream &)> &serializer) {
+            std::ostringstream out;
+            if (!serializer(out) || !out) {
+                return false;
+            }
+            files_.push_back({std::move(path), std::move(out).str()});
+            return true;
+        }
+
+        bool empty() const { return files_.empty(); }
+
+    private:
+        friend class SnapshotSaver;
+        struct File {
+            std::string path;
+            std::string content;
+        };
+
+        uint64_t generation_ = 0;
+        OnFailure onFailure_ = OnFailure::Stop;
+        std::vector<File> files_;
+    };
+
+    SnapshotSaver() : state_(std::make_shared<State>()) {}
+    SnapshotSaver(const SnapshotSaver &) = delete;
+    SnapshotSaver &operator=(const SnapshotSaver &) = delete;
+    ~SnapshotSaver() { wait(); }
+
+    // Start a new snapshot, newer snapshot is never overwritten by an older
+    // one.
+    Snapshot snapshot(OnFailure onFailure = OnFailure::Stop) {
+        Snapshot snapshot;
+        snapshot.generation_ = ++generation_;
+        snapshot.onFailure_ = onFailure;
+        return snapshot;
+    }
+
+    // Write the files in the order of being added, and return false if any of
+    // them fails. Files that are not written are still different from the
+    // last written content, so they are written again by the next snapshot.
+    // Can be called from any thread.
+    bool write(const Snapshot &snapshot) const {
+        return state_->write(snapshot);
+    }
+
+    // Write the snapshot on a new thread.
+    void writeAsync(Snapshot snapshot) {
+        std::erase_if(pending_, [](const std::future<bool> &future) {
+            return future.wait_for(std::chrono::seconds(0)) ==
+                   std::future_status::ready;
+        });
+        if (snapshot.empty()) {
+            return;
+        }
+        pending_.push_back(std::async(
+            std::launch::async,
+            [state = state_, snapshot = std::move(snapshot)]() {
+                return state->write(snapshot);
+            }));
+    }
+
+    // Wait for all the writes started by writeAsync, e.g. before the files
+    // are read again.
+    void wait() {
+        for (auto &future : pending_) {
+            future.wait();
+        }
+        pending_.clear();
+    }
+
+private:
+    // Shared with writing threads.
+    struct State {
+        // Identity of the file on disk, so it is written again if it is
+        // removed or replaced by someone else.
+        struct FileId {
+            dev_t device = 0;
+            ino_t inode = 0;
+            off_t size = -1;
+            struct timespec mtime = {};
+
+            bool operator==(const FileId &other) const {
+                return device == other.device && inode == other.inode &&
+                       size == other.size &&
+                       mtime.tv_sec == other.mtime.tv_sec &&
+                       mtime.tv_nsec == other.mtime.tv_nsec;
+            }
+        };
+
+        struct Written {
+            uint64_t generation = 0;
+            size_t size = 0;
+            size_t hash = 0;
+            FileId id;
+        };
+
+        static FileId fileId(const std::string &path) {
+            auto file = StandardPaths::global().openUser(
+                StandardPathsType::PkgData, path, O_RDONLY | O_CLOEXEC);
+            struct stat st;
+            if (!file.isValid() || ::fstat(file.fd(), &st) != 0) {
+                return {};
+            }
+            return {.device = st.st_dev,
+                    .inode = st.st_ino,
+                    .size = st.st_size,
+                    .mtime = st.st_mtim};
+        }
+
+        bool write(const Snapshot &snapshot) {
+            std::lock_guard<std::mutex> lock(mutex);
+            bool success = true;
+            for (const auto &file : snapshot.files_) {
+                auto &written = files[file.path];
+                if (snapshot.generation_ < written.generation) {
+                    continue;
+                }
+                const auto hash = std::hash<std::string_view>{}(file.content);
+                if (written.generation != 0 &&
+                    written.size == file.content.size() &&
+                    written.hash == hash && written.id == fileId(file.path)) {
+                    written.generation = snapshot.generation_;
+                    continue;
+                }
+                if (!StandardPaths::global().safeSave(
+                        StandardPathsType::PkgData, file.path,
+                        [&content = file.content](int fd) {
+                            return fs::safeWrite(fd, content.data(),
+                                                 content.size()) ==
+                                       static_cast<ssize_t>(content.size()) &&
+                                   ::fsync(fd) == 0;
+                        })) {
+                    if (snapshot.onFailure_ == OnFailure::Stop) {
+                        return false;
+                    }
+                    success = false;
+                    continue;
+                }
+                written = {.generation = snapshot.generation_,
+                           .size = file.content.size(),
+                           .hash = hash,
+                           .id = fileId(file.path)};
+            }
+            return success;
+        }
+
+        std::mutex mutex;
+        std::unordered_map<std::string, Written> files;
+    };
+
+    uint64_t generation_ = 0;
+    std::shared_ptr<State> state_;
+    std::vector<std::future<bool>> pending_;
+};
+
+} // namespace fcitx
+
+#endif // _COMMON_SNAPSHOTSAVER_H_
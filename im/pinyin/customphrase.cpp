@@ -5,12 +5,15 @@
  *
  */
 #include "customphrase.h"
+#include "../../common/mappedfile.h"
 #include <algorithm>
 #include <cassert>
 #include <charconv>
 #include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <ctime>
+#include <exception>
 #include <fcitx-utils/charutils.h>
 #include <fcitx-utils/log.h>
 #include <fcitx-utils/stringutils.h>
@@ -20,11 +23,12 @@
 #include <iterator>
 #include <libime/core/datrie.h>
 #include <limits>
-#include <map>
 #include <optional>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <sys/stat.h>
 #include <system_error>
 #include <tuple>
 #include <utility>
@@ -151,16 +155,16 @@ inline std::tm currentTm() {
 #endif
 }
 
-int currentYear() { return currentTm().tm_year + 1900; }
-int currentMonth() { return currentTm().tm_mon + 1; }
-int currentDay() { return currentTm().tm_mday; }
-int currentWeekday() { return currentTm().tm_wday; }
-int currentHour() { return currentTm().tm_hour; }
-int currentMinute() { return currentTm().tm_min; }
-int currentSecond() { return currentTm().tm_sec; }
-int currentHalfHour() {
-    const int hour = currentHour() % 12;
-    return (hour == 0) ? 12 : hour;
+int year(const std::tm &time) { return time.tm_year + 1900; }
+int month(const std::tm &time) { return time.tm_mon + 1; }
+int day(const std::tm &time) { return time.tm_mday; }
+int weekday(const std::tm &time) { return time.tm_wday; }
+int hour(const std::tm &time) { return time.tm_hour; }
+int minute(const std::tm &time) { return time.tm_min; }
+int second(const std::tm &time) { return time.tm_sec; }
+int halfHour(const std::tm &time) {
+    const int result = hour(time) % 12;
+    return (result == 0) ? 12 : result;
 }
 
 std::string toChineseYear(std::string_view num) {
@@ -211,21 +215,150 @@ std::string toChineseTwoDigitNumber(int num, bool leadingZero) {
     return prefix + suffix;
 }
 
+using BuiltinEvaluator = std::string (*)(const std::tm &time);
+
+struct BuiltinVariable {
+    std::string_view name;
+    BuiltinEvaluator evaluate;
+};
+
+constexpr BuiltinVariable builtinVariables[] = {
+    {"year", [](const std::tm &t) { return std::to_string(year(t)); }},
+    {"year_yy",
+     [](const std::tm &t) { return std::format("{:02d}", year(t) % 100); }},
+    {"month", [](const std::tm &t) { return std::to_string(month(t)); }},
+    {"month_mm",
+     [](const std::tm &t) { return std::format("{:02d}", month(t)); }},
+    {"day", [](const std::tm &t) { return std::to_string(day(t)); }},
+    {"day_dd", [](const std::tm &t) { return std::format("{:02d}", day(t)); }},
+    {"weekday", [](const std::tm &t) { return std::to_string(weekday(t)); }},
+    {"fullhour",
+     [](const std::tm &t) { return std::format("{:02d}", hour(t)); }},
+    {"halfhour",
+     [](const std::tm &t) { return std::format("{:02d}", halfHour(t)); }},
+    {"ampm",
+     [](const std::tm &t) { return std::string(hour(t) < 12 ? "AM" : "PM"); }},
+    {"minute",
+     [](const std::tm &t) { return std::format("{:02d}", minute(t)); }},
+    {"second",
+     [](const std::tm &t) { return std::format("{:02d}", second(t)); }},
+    {"year_cn",
+     [](const std::tm &t) { return toChineseYear(std::to_string(year(t))); }},
+    {"year_yy_cn",
+     [](const std::tm &t) {
+         return toChineseYear(std::format("{:02d}", year(t) % 100));
+     }},
+    {"month_cn",
+     [](const std::tm &t) {
+         return toChineseTwoDigitNumber(month(t), /*leadingZero=*/false);
+     }},
+    {"day_cn",
+     [](const std::tm &t) {
+         return toChineseTwoDigitNumber(day(t), /*leadingZero=*/false);
+     }},
+    {"weekday_cn",
+     [](const std::tm &t) { return toChineseWeekDay(weekday(t)); }},
+    {"fullhour_cn",
+     [](const std::tm &t) {
+         return toChineseTwoDigitNumber(hour(t), /*leadingZero=*/false);
+     }},
+    {"halfhour_cn",
+     [](const std::tm &t) {
+         return toChineseTwoDigitNumber(halfHour(t), /*leadingZero=*/false);
+     }},
+    {"ampm_cn",
+     [](const std::tm &t) {
+         return std::string(hour(t) < 12 ? "上午" : "下午");
+     }},
+    {"minute_cn",
+     [](const std::tm &t) {
+         return toChineseTwoDigitNumber(minute(t), /*leadingZero=*/true);
+     }},
+    {"second_cn",
+     [](const std::tm &t) {
+         return toChineseTwoDigitNumber(second(t), /*leadingZero=*/true);
+     }},
+};
+
+BuiltinEvaluator findBuiltinEvaluator(std::string_view name) {
+    const auto *iter =
+        std::ranges::find(builtinVariables, name, &BuiltinVariable::name);
+    if (iter == std::end(builtinVariables)) {
+        return nullptr;
+    }
+    return iter->evaluate;
+}
+
+constexpr std::string_view SnapshotMagic = "FCCP";
+// Bump when the layout or the content of snapshot changes.
+constexpr uint32_t SnapshotVersion = 1;
+
+// Written in native byte order, a snapshot from other architecture will fail
+// the version check and be regenerated.
+struct SnapshotHeader {
+    char magic[4];
+    uint32_t version;
+    // Source file that snapshot is generated from.
+    int64_t sourceMTimeSec;
+    int64_t sourceMTimeNSec;
+    uint64_t sourceSize;
+    uint32_t entrySize;
+    uint32_t phraseSize;
+    uint32_t arenaSize;
+    uint32_t trieSize;
+};
+
+// Phrases of data_[i] are phrases[first, first + count).
+struct SnapshotEntry {
+    uint32_t first;
+    uint32_t count;
+};
+
+// Value is arena[offset, offset + length).
+struct SnapshotPhrase {
+    int32_t order;
+    uint32_t offset;
+    uint32_t length;
+};
+
+bool sameSource(const SnapshotHeader &header, const struct stat &source) {
+    return header.sourceMTimeSec == source.st_mtim.tv_sec &&
+           header.sourceMTimeNSec == source.st_mtim.tv_nsec &&
+           header.sourceSize == static_cast<uint64_t>(source.st_size);
+}
+
 } // namespace
 
 bool CustomPhrase::isDynamic() const { return value().starts_with("#"); }
 
-std::string CustomPhrase::evaluate(
-    const std::function<std::string(std::string_view key)> &evaluator) const {
-    assert(evaluator);
-
+void CustomPhrase::compile() {
+    tokens_.clear();
     if (!isDynamic()) {
-        return value_;
+        return;
     }
-    std::string_view content = value_;
-    content = content.substr(1);
-    std::string output;
-    output.reserve(content.size());
+
+    auto addLiteral = [this](size_t offset, size_t length) {
+        // Merge adjacent literal.
+        if (!tokens_.empty() && !tokens_.back().isVariable &&
+            tokens_.back().offset + tokens_.back().length == offset) {
+            tokens_.back().length += length;
+            return;
+        }
+        tokens_.push_back({.offset = static_cast<uint32_t>(offset),
+                           .length = static_cast<uint32_t>(length),
+                           .isVariable = false,
+                           .builtin = nullptr});
+    };
+    auto addVariable = [this](size_t offset, size_t length) {
+        tokens_.push_back(
+            {.offset = static_cast<uint32_t>(offset),
+             .length = static_cast<uint32_t>(length),
+             .isVariable = true,
+             .builtin = findBuiltinEvaluator(
+                 std::string_view(value_).substr(offset, length))});
+    };
+
+    const std::string_view content = value_;
     size_t variableNameStart = 0;
     size_t variableNameLength = 0;
 
@@ -238,7 +371,8 @@ std::string CustomPhrase::evaluate(
 
     auto state = State::Normal;
 
-    for (size_t i = 0; i < content.size();) {
+    // Skip the leading #.
+    for (size_t i = 1; i < content.size();) {
         const char c = content[i];
 
         switch (state) {
@@ -246,7 +380,7 @@ std::string CustomPhrase::evaluate(
             if (c == '$') {
                 state = State::VariableStart;
             } else {
-                output += c;
+                addLiteral(i, 1);
             }
             i += 1;
             break;
@@ -257,7 +391,7 @@ std::string CustomPhrase::evaluate(
                 variableNameLength = 0;
                 state = State::BracedVariable;
             } else if (c == '$') {
-                output += '$';
+                addLiteral(i, 1);
                 state = State::Normal;
             } else if (charutils::islower(c) || charutils::isupper(c) ||
                        c == '_') {
@@ -265,8 +399,8 @@ std::string CustomPhrase::evaluate(
                 variableNameLength = 1;
                 state = State::Variable;
             } else {
-                output += '$';
-                output += c;
+                // Keep both $ and c.
+                addLiteral(i - 1, 2);
                 state = State::Normal;
             }
             i += 1;
@@ -274,8 +408,7 @@ std::string CustomPhrase::evaluate(
 
         case State::BracedVariable:
             if (c == '}') {
-                output += evaluator(
-                    content.substr(variableNameStart, variableNameLength));
+                addVariable(variableNameStart, variableNameLength);
                 state = State::Normal;
             } else {
                 variableNameLength += 1;
@@ -291,8 +424,7 @@ std::string CustomPhrase::evaluate(
                 state = State::Variable;
                 i += 1;
             } else {
-                output += evaluator(
-                    content.substr(variableNameStart, variableNameLength));
+                addVariable(variableNameStart, variableNameLength);
                 state = State::Normal;
             }
             break;
@@ -303,88 +435,66 @@ std::string CustomPhrase::evaluate(
     case State::Normal:
         break;
     case State::VariableStart:
-        output += '$';
+        addLiteral(content.size() - 1, 1);
         break;
     case State::BracedVariable:
-        output += "${";
-        output += content.substr(variableNameStart, variableNameLength);
+        // Unterminated, keep the "${name" as is.
+        addLiteral(variableNameStart - 2, variableNameLength + 2);
         break;
     case State::Variable:
-        output +=
-            evaluator(content.substr(variableNameStart, variableNameLength));
+        addVariable(variableNameStart, variableNameLength);
         break;
     }
+}
 
+template <typename Callback>
+std::string CustomPhrase::evaluateImpl(const Callback &callback) const {
+    if (!isDynamic()) {
+        return value_;
+    }
+    const std::string_view content = value_;
+    std::string output;
+    output.reserve(content.size());
+    for (const auto &token : tokens_) {
+        const auto span = content.substr(token.offset, token.length);
+        if (token.isVariable) {
+            output += callback(token, span);
+        } else {
+            output += span;
+        }
+    }
     return output;
 }
 
+std::string CustomPhrase::evaluate(const Evaluator &evaluator) const {
+    assert(evaluator);
+    return evaluateImpl(
+        [&evaluator](const Token &, std::string_view name) -> std::string {
+            return evaluator(name);
+        });
+}
+
+std::string CustomPhrase::evaluate(const std::tm &time,
+                                   const Evaluator &evaluator) const {
+    assert(evaluator);
+    return evaluateImpl([&time, &evaluator](const Token &token,
+                                            std::string_view name) {
+        if (token.builtin) {
+            return token.builtin(time);
+        }
+        return evaluator(name);
+    });
+}
+
 std::string CustomPhrase::builtinEvaluator(std::string_view key) {
-    static const std::map<std::string, std::function<std::string()>,
-                          std::less<>>
-        table = {
-            {"year", []() { return std::to_string(currentYear()); }},
-            {"year_yy",
-             []() { return std::format("{:02d}", currentYear() % 100); }},
-            {"month", []() { return std::to_string(currentMonth()); }},
-            {"month_mm",
-             []() { return std::format("{:02d}", currentMonth()); }},
-            {"day", []() { return std::to_string(currentDay()); }},
-            {"day_dd", []() { return std::format("{:02d}", currentDay()); }},
-            {"weekday", []() { return std::to_string(currentWeekday()); }},
-            {"fullhour", []() { return std::format("{:02d}", currentHour()); }},
-            {"halfhour",
-             []() { return std::format("{:02d}", currentHalfHour()); }},
-            {"ampm", []() { return currentHour() < 12 ? "AM" : "PM"; }},
-            {"minute", []() { return std::format("{:02d}", currentMinute()); }},
-            {"second", []() { return std::format("{:02d}", currentSecond()); }},
-            {"year_cn",
-             []() { return toChineseYear(std::to_string(currentYear())); }},
-            {"year_yy_cn",
-             []() {
-                 return toChineseYear(
-                     std::format("{:02d}", currentYear() % 100));
-             }},
-            {"month_cn",
-             []() {
-                 return toChineseTwoDigitNumber(currentMonth(),
-                                                /*leadingZero=*/false);
-             }},
-            {"day_cn",
-             []() {
-                 return toChineseTwoDigitNumber(currentDay(),
-                                                /*leadingZero=*/false);
-             }},
-            {"weekday_cn", []() { return toChineseWeekDay(currentWeekday()); }},
-            {"fullhour_cn",
-             []() {
-                 return toChineseTwoDigitNumber(currentHour(),
-                                                /*leadingZero=*/false);
-             }},
-            {"halfhour_cn",
-             []() {
-                 return toChineseTwoDigitNumber(currentHalfHour(),
-                                                /*leadingZero=*/false);
-             }},
-            {"ampm_cn", []() { return currentHour() < 12 ? "上午" : "下午"; }},
-            {"minute_cn",
-             []() {
-                 return toChineseTwoDigitNumber(currentMinute(),
-                                                /*leadingZero=*/true);
-             }},
-            {"second_cn",
-             []() {
-                 return toChineseTwoDigitNumber(currentSecond(),
-                                                /*leadingZero=*/true);
-             }},
-        };
-
-    auto iter = table.find(key);
-    if (iter != table.end()) {
-        return iter->second();
+    if (auto builtin = findBuiltinEvaluator(key)) {
+        return builtin(currentTm());
     }
     return "";
 }
 
+std::tm CustomPhrase::currentTime() { return currentTm(); }
+
 CustomPhraseDict::CustomPhraseDict() = default;
 
 void CustomPhraseDict::load(std::istream &in, bool loadDisabled) {
@@ -393,17 +503,24 @@ void CustomPhraseDict::load(std::istream &in, bool loadDisabled) {
     // Line looks like
     // [a-z]+,[-][0-9]+=phrase
     CustomPhrase *multiline = nullptr;
+    // Value of multiline is collected here, and set when it ends, so the
+    // phrase is only compiled once.
+    std::string multilineValue;
     // If loadDisabled is true
     CustomPhrase dummyPhrase(-1, {});
-    auto cleanUpMultiline = [&multiline]() {
+    auto cleanUpMultiline = [&multiline, &multilineValue, &dummyPhrase]() {
         if (!multiline) {
             return;
         }
 
-        if (!multiline->value().empty()) {
-            multiline->mutableValue().pop_back();
+        if (!multilineValue.empty()) {
+            multilineValue.pop_back();
+        }
+        if (multiline != &dummyPhrase) {
+            multiline->setValue(std::move(multilineValue));
         }
 
+        multilineValue.clear();
         multiline = nullptr;
     };
 
@@ -446,10 +563,10 @@ void CustomPhraseDict::load(std::istream &in, bool loadDisabled) {
                 multiline = &data_[index].back();
             }
         } else if (multiline && multiline != &dummyPhrase) {
-            multiline->mutableValue().append(line);
+            multilineValue.append(line);
             // Always append new line, and we will pop the last new line in
             // cleanUpMultiline.
-            multiline->mutableValue().append("\n");
+            multilineValue.append("\n");
         }
     }
     cleanUpMultiline();
@@ -544,6 +661,125 @@ void CustomPhraseDict::save(std::ostream &out) const {
     });
 }
 
+bool CustomPhraseDict::loadSnapshot(std::string_view data,
+                                    const struct stat &source) {
+    SnapshotHeader header;
+    if (data.size() < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    const size_t entryBytes =
+        static_cast<size_t>(header.entrySize) * sizeof(SnapshotEntry);
+    const size_t phraseBytes =
+        static_cast<size_t>(header.phraseSize) * sizeof(SnapshotPhrase);
+    if (std::string_view(header.magic, sizeof(header.magic)) !=
+            SnapshotMagic ||
+        header.version != SnapshotVersion || !sameSource(header, source) ||
+        data.size() != sizeof(header) + entryBytes + phraseBytes +
+                           header.arenaSize + header.trieSize) {
+        return false;
+    }
+    data.remove_prefix(sizeof(header));
+
+    std::vector<SnapshotEntry> entries(header.entrySize);
+    std::memcpy(entries.data(), data.data(), entryBytes);
+    data.remove_prefix(entryBytes);
+    std::vector<SnapshotPhrase> phrases(header.phraseSize);
+    std::memcpy(phrases.data(), data.data(), phraseBytes);
+    data.remove_prefix(phraseBytes);
+    const auto arena = data.substr(0, header.arenaSize);
+    data.remove_prefix(header.arenaSize);
+
+    std::vector<std::vector<CustomPhrase>> newData;
+    newData.reserve(entries.size());
+    for (const auto &entry : entries) {
+        if (static_cast<size_t>(entry.first) + entry.count > phrases.size()) {
+            return false;
+        }
+        auto &item = newData.emplace_back();
+        item.reserve(entry.count);
+        for (uint32_t i = entry.first; i < entry.first + entry.count; i++) {
+            const auto &phrase = phrases[i];
+            if (static_cast<size_t>(phrase.offset) + phrase.length >
+                arena.size()) {
+                return false;
+            }
+            item.push_back(CustomPhrase(
+                phrase.order,
+                std::string(arena.substr(phrase.offset, phrase.length))));
+        }
+    }
+
+    TrieType newIndex;
+    try {
+        MappedFileStreamBuf buffer(data);
+        std::istream in(&buffer);
+        newIndex.load(in);
+    } catch (const std::exception &) {
+        return false;
+    }
+    bool valid = true;
+    newIndex.foreach([&valid, &newData](uint32_t value, size_t,
+                                        TrieType::position_type) {
+        valid = value < newData.size();
+        return valid;
+    });
+    if (!valid) {
+        return false;
+    }
+
+    index_ = std::move(newIndex);
+    data_ = std::move(newData);
+    return true;
+}
+
+bool CustomPhraseDict::saveSnapshot(std::ostream &out,
+                                    const struct stat &source) {
+    std::vector<SnapshotEntry> entries;
+    std::vector<SnapshotPhrase> phrases;
+    std::string arena;
+    entries.reserve(data_.size());
+    for (const auto &item : data_) {
+        entries.push_back(
+            {.first = static_cast<uint32_t>(phrases.size()),
+             .count = static_cast<uint32_t>(item.size())});
+        for (const auto &phrase : item) {
+            phrases.push_back(
+                {.order = phrase.order(),
+                 .offset = static_cast<uint32_t>(arena.size()),
+                 .length = static_cast<uint32_t>(phrase.value().size())});
+            arena.append(phrase.value());
+        }
+    }
+    if (arena.size() > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+
+    std::ostringstream trie;
+    index_.save(trie);
+    const auto trieData = trie.str();
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, SnapshotMagic.data(), sizeof(header.magic));
+    header.version = SnapshotVersion;
+    header.sourceMTimeSec = source.st_mtim.tv_sec;
+    header.sourceMTimeNSec = source.st_mtim.tv_nsec;
+    header.sourceSize = source.st_size;
+    header.entrySize = entries.size();
+    header.phraseSize = phrases.size();
+    header.arenaSize = arena.size();
+    header.trieSize = trieData.size();
+
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(entries.data()),
+              entries.size() * sizeof(SnapshotEntry));
+    out.write(reinterpret_cast<const char *>(phrases.data()),
+              phrases.size() * sizeof(SnapshotPhrase));
+    out.write(arena.data(), arena.size());
+    out.write(trieData.data(), trieData.size());
+    return static_cast<bool>(out);
+}
+
 void CustomPhraseDict::clear() {
     index_.clear();
     data_.clear();
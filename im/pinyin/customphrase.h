@@ -9,6 +9,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <ctime>
 #include <fcitx-utils/macros.h>
 #include <functional>
 #include <istream>
@@ -16,6 +17,7 @@
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <sys/stat.h>
 #include <utility>
 #include <vector>
 
@@ -23,26 +25,57 @@ namespace fcitx {
 
 class CustomPhrase {
 public:
+    using Evaluator = std::function<std::string(std::string_view key)>;
+
     explicit CustomPhrase(int order, std::string value)
-        : order_(order), value_(std::move(value)) {}
+        : order_(order), value_(std::move(value)) {
+        compile();
+    }
     FCITX_INLINE_DEFINE_DEFAULT_DTOR_COPY_AND_MOVE_WITH_SPEC(CustomPhrase,
                                                              noexcept)
 
     int order() const { return order_; }
     const std::string &value() const { return value_; }
     void setOrder(int order) { order_ = order; }
-    std::string &mutableValue() { return value_; }
+    void setValue(std::string value) {
+        value_ = std::move(value);
+        compile();
+    }
 
     bool isDynamic() const;
 
-    std::string evaluate(const std::function<std::string(std::string_view key)>
-                             &evaluator) const;
+    // Resolve all variables with evaluator, including the builtin ones like
+    // ${year}. They are left empty unless the evaluator handles them, e.g. by
+    // falling back to builtinEvaluator.
+    std::string evaluate(const Evaluator &evaluator) const;
+    // Resolve builtin variables with time, and the rest with evaluator. Time
+    // should be obtained once from currentTime() for all the phrases that are
+    // evaluated together.
+    std::string evaluate(const std::tm &time, const Evaluator &evaluator) const;
 
     static std::string builtinEvaluator(std::string_view key);
+    static std::tm currentTime();
 
 private:
+    using BuiltinEvaluator = std::string (*)(const std::tm &time);
+
+    // Dynamic phrase is split into tokens when it is created. A token is
+    // either a literal part or a variable name, both are a span of value_.
+    struct Token {
+        uint32_t offset;
+        uint32_t length;
+        bool isVariable;
+        // Resolved builtin variable, null if it needs the evaluator.
+        BuiltinEvaluator builtin;
+    };
+
+    void compile();
+    template <typename Callback>
+    std::string evaluateImpl(const Callback &callback) const;
+
     int order_ = -1;
     std::string value_;
+    std::vector<Token> tokens_;
 };
 
 class CustomPhraseDict {
@@ -54,6 +87,12 @@ public:
     void save(std::ostream &out) const;
     void clear();
 
+    // Binary snapshot of the dictionary, so it can be loaded without parsing
+    // the text file. Snapshot records the file it is generated from, and
+    // loading fails if it does not match source anymore.
+    bool loadSnapshot(std::string_view data, const struct stat &source);
+    bool saveSnapshot(std::ostream &out, const struct stat &source);
+
     const std::vector<CustomPhrase> *lookup(std::string_view key) const;
 
     void addPhrase(std::string_view key, std::string_view value, int order);
@@ -0,0 +1,360 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#include "learningjournal.h"
+#include "../../common/mappedfile.h"
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <fcitx-utils/fs.h>
+#include <fcitx-utils/log.h>
+#include <fcitx-utils/standardpaths.h>
+#include <fcitx-utils/stringutils.h>
+#include <fcitx-utils/unixfd.h>
+#include <fcntl.h>
+#include <libime/core/historybigram.h>
+#include <libime/core/userlanguagemodel.h>
+#include <libime/pinyin/pinyindictionary.h>
+#include <libime/pinyin/pinyinime.h>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace fcitx {
+
+namespace {
+
+constexpr char JournalPath[] = "pinyin/user.journal";
+constexpr char HistoryPath[] = "pinyin/user.history";
+// Number of records before the journal is folded into user.dict and
+// user.history.
+constexpr size_t MaxJournalSize = 4096;
+
+bool isValidField(std::string_view value) {
+    return value.find_first_of("\t\n") == std::string_view::npos;
+}
+
+// Encoded pinyin is binary, store it as hex.
+std::string toHex(std::string_view data) {
+    constexpr std::string_view digits = "0123456789abcdef";
+    std::string result;
+    result.reserve(data.size() * 2);
+    for (const char c : data) {
+        const auto byte = static_cast<unsigned char>(c);
+        result.push_back(digits[byte >> 4]);
+        result.push_back(digits[byte & 0xf]);
+    }
+    return result;
+}
+
+std::optional<std::string> fromHex(std::string_view data) {
+    auto value = [](char c) -> int {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f') {
+            return c - 'a' + 10;
+        }
+        return -1;
+    };
+    if (data.size() % 2 != 0) {
+        return std::nullopt;
+    }
+    std::string result;
+    result.reserve(data.size() / 2);
+    for (size_t i = 0; i < data.size(); i += 2) {
+        const int high = value(data[i]);
+        const int low = value(data[i + 1]);
+        if (high < 0 || low < 0) {
+            return std::nullopt;
+        }
+        result.push_back(static_cast<char>((high << 4) | low));
+    }
+    return result;
+}
+
+struct stat historyStat() {
+    struct stat st{};
+    auto file = StandardPaths::global().openUser(
+        StandardPathsType::PkgData, HistoryPath, O_RDONLY | O_CLOEXEC);
+    if (!file.isValid() || fstat(file.fd(), &st) != 0) {
+        return {};
+    }
+    return st;
+}
+
+// Apply a single record, return false if it is malformed.
+bool replay(libime::PinyinIME *ime, const std::vector<std::string> &tokens) {
+    const auto &type = tokens[0];
+    if ((type == "W" || type == "R") && tokens.size() == 3) {
+        if (type == "W") {
+            ime->dict()->addWord(libime::PinyinDictionary::UserDict,
+                                 tokens[1], tokens[2]);
+        } else {
+            ime->dict()->removeWord(libime::PinyinDictionary::UserDict,
+                                    tokens[1], tokens[2]);
+        }
+        return true;
+    }
+    if (type == "H" && tokens.size() >= 3 && tokens.size() % 2 == 1) {
+        std::vector<libime::HistoryBigram::WordWithCode> words;
+        for (size_t i = 1; i < tokens.size(); i += 2) {
+            auto code = fromHex(tokens[i + 1]);
+            if (!code) {
+                return false;
+            }
+            words.emplace_back(tokens[i], std::move(*code));
+        }
+        ime->model()->history().addWithCode(words);
+        return true;
+    }
+    if (type == "F" && tokens.size() == 2) {
+        ime->model()->history().forget(tokens[1]);
+        return true;
+    }
+    if (type == "C" && tokens.size() == 2) {
+        if (tokens[1] == "dict") {
+            ime->dict()->clear(libime::PinyinDictionary::UserDict);
+        } else if (tokens[1] == "history") {
+            ime->model()->history().clear();
+        } else {
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+void LearningJournal::load(libime::PinyinIME *ime) {
+    log_.reset();
+    logSize_ = 0;
+    incomplete_ = false;
+    compactRequested_ = false;
+
+    auto file = StandardPaths::global().openUser(
+        StandardPathsType::PkgData, JournalPath, O_RDONLY | O_CLOEXEC);
+    MappedFile mapped(file.fd());
+    if (!mapped.isValid()) {
+        return;
+    }
+    file.reset();
+
+    auto content = mapped.view();
+    auto next = [&content]() -> std::optional<std::string_view> {
+        auto pos = content.find('\n');
+        // Last record is incomplete, e.g. crashed when writing it.
+        if (pos == std::string_view::npos) {
+            return std::nullopt;
+        }
+        auto line = content.substr(0, pos);
+        content.remove_prefix(pos + 1);
+        return line;
+    };
+
+    // Journal is written on top of another user.history, changes are either
+    // already in it, or lost together with it.
+    auto stamp = next();
+    if (!stamp || *stamp != stampLine(historyStat())) {
+        reset();
+        return;
+    }
+
+    while (auto line = next()) {
+        logSize_ += 1;
+        auto tokens = stringutils::split(*line, "\t",
+                                         stringutils::SplitBehavior::KeepEmpty);
+        try {
+            if (tokens.empty() || !replay(ime, tokens)) {
+                incomplete_ = true;
+            }
+        } catch (const std::exception &e) {
+            FCITX_WARN() << "Failed to replay pinyin learning journal: "
+                         << e.what();
+            incomplete_ = true;
+        }
+    }
+    if (!content.empty()) {
+        // Drop the incomplete record, a truncated one may still look valid
+        // once new records are appended after it.
+        const auto complete =
+            mapped.view().substr(0, mapped.size() - content.size());
+        if (!StandardPaths::global().safeSave(
+                StandardPathsType::PkgData, JournalPath, [&complete](int fd) {
+                    return fs::safeWrite(fd, complete.data(),
+                                         complete.size()) ==
+                           static_cast<ssize_t>(complete.size());
+                })) {
+            incomplete_ = true;
+        }
+    }
+    checkNeedCompact();
+}
+
+void LearningJournal::addWord(std::string_view pinyin,
+                              std::string_view hanzi) {
+    if (!isValidField(pinyin) || !isValidField(hanzi)) {
+        markIncomplete();
+        return;
+    }
+    append(stringutils::concat("W\t", pinyin, "\t", hanzi, "\n"));
+}
+
+void LearningJournal::removeWord(std::string_view pinyin,
+                                 std::string_view hanzi) {
+    if (!isValidField(pinyin) || !isValidField(hanzi)) {
+        markIncomplete();
+        return;
+    }
+    append(stringutils::concat("R\t", pinyin, "\t", hanzi, "\n"));
+}
+
+void LearningJournal::addHistory(
+    const std::vector<libime::HistoryBigram::WordWithCode> &words) {
+    if (words.empty()) {
+        return;
+    }
+    std::string line = "H";
+    for (const auto &[word, code] : words) {
+        if (!isValidField(word)) {
+            markIncomplete();
+            return;
+        }
+        line.append(stringutils::concat("\t", word, "\t", toHex(code)));
+    }
+    line.push_back('\n');
+    append(std::move(line));
+}
+
+void LearningJournal::forget(std::string_view word) {
+    if (!isValidField(word)) {
+        markIncomplete();
+        return;
+    }
+    append(stringutils::concat("F\t", word, "\n"));
+}
+
+void LearningJournal::clearUserDict() { append("C\tdict\n"); }
+
+void LearningJournal::clearHistory() { append("C\thistory\n"); }
+
+bool LearningJournal::needCompact() const {
+    return incomplete_ || logSize_ >= MaxJournalSize;
+}
+
+void LearningJournal::setNeedCompactCallback(std::function<void()> callback) {
+    needCompactCallback_ = std::move(callback);
+}
+
+LearningJournal::Checkpoint LearningJournal::checkpoint() {
+    incomplete_ = false;
+    struct stat st;
+    auto file = StandardPaths::global().openUser(
+        StandardPathsType::PkgData, JournalPath, O_RDONLY | O_CLOEXEC);
+    if (!file.isValid() || fstat(file.fd(), &st) != 0) {
+        return {};
+    }
+    return {.offset = st.st_size};
+}
+
+void LearningJournal::reset(const Checkpoint &checkpoint) {
+    auto file = StandardPaths::global().openUser(
+        StandardPathsType::PkgData, JournalPath, O_RDONLY | O_CLOEXEC);
+    MappedFile mapped(file.fd());
+    file.reset();
+
+    std::string_view records;
+    if (mapped.isValid() &&
+        static_cast<size_t>(checkpoint.offset) <= mapped.size()) {
+        records = mapped.view().substr(checkpoint.offset);
+        // Journal is created after the checkpoint, skip its stamp.
+        if (checkpoint.offset == 0) {
+            const auto pos = records.find('\n');
+            records = pos == std::string_view::npos ? std::string_view()
+                                                    : records.substr(pos + 1);
+        }
+        // Only keep complete records.
+        records = records.substr(0, records.rfind('\n') + 1);
+    }
+    rewrite(records);
+}
+
+void LearningJournal::reset() {
+    incomplete_ = false;
+    rewrite({});
+}
+
+void LearningJournal::rewrite(std::string_view records) {
+    log_.reset();
+    auto content = stampLine(historyStat());
+    content.push_back('\n');
+    content.append(records);
+    if (StandardPaths::global().safeSave(
+            StandardPathsType::PkgData, JournalPath, [&content](int fd) {
+                return fs::safeWrite(fd, content.data(), content.size()) ==
+                       static_cast<ssize_t>(content.size());
+            })) {
+        logSize_ = std::ranges::count(records, '\n');
+        compactRequested_ = false;
+        checkNeedCompact();
+    } else {
+        incomplete_ = true;
+        // Don't ask for compaction on every change if journal can't be
+        // written.
+        compactRequested_ = true;
+    }
+}
+
+void LearningJournal::append(std::string line) {
+    if (!log_.isValid()) {
+        log_ = StandardPaths::global().openUser(
+            StandardPathsType::PkgData, JournalPath,
+            O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC);
+        struct stat st;
+        if (log_.isValid() && fstat(log_.fd(), &st) == 0 && st.st_size == 0) {
+            line = stringutils::concat(stampLine(historyStat()), "\n", line);
+        }
+    }
+    if (!log_.isValid()) {
+        markIncomplete();
+        return;
+    }
+    if (fs::safeWrite(log_.fd(), line.data(), line.size()) !=
+        static_cast<ssize_t>(line.size())) {
+        // Some record may be partially written, start over on next save.
+        markIncomplete();
+        return;
+    }
+    logSize_ += 1;
+    checkNeedCompact();
+}
+
+void LearningJournal::markIncomplete() {
+    incomplete_ = true;
+    checkNeedCompact();
+}
+
+void LearningJournal::checkNeedCompact() {
+    if (compactRequested_ || !needCompact() || !needCompactCallback_) {
+        return;
+    }
+    compactRequested_ = true;
+    needCompactCallback_();
+}
+
+std::string LearningJournal::stampLine(const struct stat &history) {
+    return stringutils::concat("S\t", history.st_mtim.tv_sec, "\t",
+                               history.st_mtim.tv_nsec, "\t",
+                               history.st_size);
+}
+
+} // namespace fcitx
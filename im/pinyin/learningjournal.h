@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#ifndef _PINYIN_LEARNINGJOURNAL_H_
+#define _PINYIN_LEARNINGJOURNAL_H_
+
+#include <cstddef>
+#include <fcitx-utils/unixfd.h>
+#include <functional>
+#include <libime/core/historybigram.h>
+#include <libime/pinyin/pinyinime.h>
+#include <string>
+#include <string_view>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <vector>
+
+namespace fcitx {
+
+// Append-only log of the changes to the pinyin user dictionary and history,
+// so they don't need to be rewritten in full on every save.
+//
+// The journal is kept in $XDG_DATA_HOME/fcitx5/pinyin/user.journal, one
+// tab separated record per line. The first line records the user.history it
+// extends, the journal is ignored if user.history is replaced afterwards, so
+// a crash between compaction and resetting the journal won't apply the same
+// changes twice.
+//
+// Each record is appended with a single small write on the main thread,
+// without fsync. It is cheap on local disks and keeps the record even if
+// fcitx crashes right after, at the cost of possibly blocking on a slow
+// network file system.
+class LearningJournal {
+public:
+    // Replay the journal on top of the user dictionary and history that are
+    // just loaded from disk.
+    void load(libime::PinyinIME *ime);
+
+    void addWord(std::string_view pinyin, std::string_view hanzi);
+    void removeWord(std::string_view pinyin, std::string_view hanzi);
+    void
+    addHistory(const std::vector<libime::HistoryBigram::WordWithCode> &words);
+    void forget(std::string_view word);
+    void clearUserDict();
+    void clearHistory();
+
+    // Whether the journal should be folded into user.dict and user.history.
+    bool needCompact() const;
+    // Called once needCompact() becomes true, until the journal is reset.
+    void setNeedCompactCallback(std::function<void()> callback);
+
+    // Position in the journal, changes before it are in the snapshot of
+    // user.dict and user.history being saved.
+    struct Checkpoint {
+        off_t offset = 0;
+    };
+    // Called when the snapshot is taken.
+    Checkpoint checkpoint();
+    // Start a new journal on top of the current user.history, called after
+    // the snapshot is saved. Changes after checkpoint are kept.
+    void reset(const Checkpoint &checkpoint);
+    // Start a new empty journal on top of the current user.history.
+    void reset();
+    // Snapshot can't be saved, so the journal still needs to be compacted.
+    void markIncomplete();
+
+private:
+    void append(std::string line);
+    void checkNeedCompact();
+    void rewrite(std::string_view records);
+    static std::string stampLine(const struct stat &history);
+
+    fcitx::UnixFD log_;
+    // Number of records in the log.
+    size_t logSize_ = 0;
+    // Set if some change is not in the log, e.g. failed to write.
+    bool incomplete_ = false;
+    bool compactRequested_ = false;
+    std::function<void()> needCompactCallback_;
+};
+
+} // namespace fcitx
+
+#endif // _PINYIN_LEARNINGJOURNAL_H_
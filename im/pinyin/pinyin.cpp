@@ -6,10 +6,13 @@
  */
 
 #include "pinyin.h"
+#include "../../common/mappedfile.h"
+#include "../../common/snapshotsaver.h"
 
 // Use relative path so we don't need import export target.
 // We want to keep cloudpinyin logic but don't call it.
 #include "../../modules/cloudpinyin/cloudpinyin_public.h"
+#include "chttrans_public.h"
 #include "config.h"
 #include "customphrase.h"
 #include "notifications_public.h"
@@ -80,6 +83,7 @@
 #include <libime/pinyin/shuangpinprofile.h>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
 #include <quickphrase_public.h>
@@ -88,6 +92,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <sys/stat.h>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -107,6 +112,11 @@ FCITX_DEFINE_LOG_CATEGORY(pinyin, "pinyin");
 #define PINYIN_DEBUG() FCITX_LOGC(pinyin, Debug)
 #define PINYIN_ERROR() FCITX_LOGC(pinyin, Error)
 
+// Binary snapshot of pinyin/customphrase, see CustomPhraseDict::loadSnapshot.
+constexpr char CustomPhraseSnapshotPath[] = "pinyin/customphrase.snapshot";
+// In microseconds.
+constexpr uint64_t CustomPhraseSaveDelay = 1000000;
+
 template <typename T>
 std::unique_ptr<CandidateList>
 predictCandidateList(PinyinEngine *engine, const std::vector<T> &words) {
@@ -228,6 +238,85 @@ std::optional<int> selectCharFromCandidateIndex(const Key &key,
     return std::nullopt;
 }
 
+// Produce candidates in the display order. Pinyin candidates from libime are
+// merged with the custom candidates one at a time, so only the candidates that
+// are actually shown need to be created.
+class PinyinCandidateGenerator {
+public:
+    PinyinCandidateGenerator(
+        PinyinEngine *engine, InputContext *inputContext,
+        std::unordered_map<std::string,
+                           std::unique_ptr<PinyinAbstractCandidateWord>>
+            customCandidateMap)
+        : engine_(engine), inputContext_(inputContext),
+          customSize_(customCandidateMap.size()) {
+        for (auto &[word, candidate] : customCandidateMap) {
+            customWords_.insert(word);
+            customCandidates_.push_back(std::move(candidate));
+        }
+        // Pinyin candidates are already in order, only the small set of
+        // custom candidates need to be sorted.
+        std::ranges::sort(customCandidates_,
+                          [](const auto &lhs, const auto &rhs) {
+                              return lhs->sortOrder() < rhs->sortOrder();
+                          });
+    }
+
+    std::unique_ptr<PinyinAbstractCandidateWord>
+    next(const std::vector<libime::SentenceResult> &pinyinCandidates) {
+        preparePinyinCandidate(pinyinCandidates);
+        if (customIndex_ < customCandidates_.size() &&
+            (!pendingPinyin_ || customCandidates_[customIndex_]->sortOrder() <
+                                    pendingPinyin_->sortOrder())) {
+            return std::move(customCandidates_[customIndex_++]);
+        }
+        return std::move(pendingPinyin_);
+    }
+
+private:
+    void preparePinyinCandidate(
+        const std::vector<libime::SentenceResult> &pinyinCandidates) {
+        while (!pendingPinyin_ && pinyinIndex_ < pinyinCandidates.size()) {
+            const auto idx = pinyinIndex_++;
+            const auto &candidate = pinyinCandidates[idx];
+            auto candidateString = candidate.toString();
+            // Already merged into custom candidate, or dropped due to
+            // different length.
+            if (customWords_.contains(candidateString)) {
+                continue;
+            }
+            const bool duplicate = !seen_.insert(candidateString).second;
+            pendingPinyin_ = std::make_unique<PinyinCandidateWord>(
+                engine_, inputContext_, Text(std::move(candidateString)),
+                candidate.sentence().back()->to()->index(), idx,
+                CandidateOrder{idx, customSize_});
+            if (duplicate) {
+                pendingPinyin_->setPinyinInComment();
+            }
+        }
+    }
+
+    PinyinEngine *engine_;
+    InputContext *inputContext_;
+    const size_t customSize_;
+    std::vector<std::unique_ptr<PinyinAbstractCandidateWord>>
+        customCandidates_;
+    std::unordered_set<std::string> customWords_;
+    std::unordered_set<std::string> seen_;
+    std::unique_ptr<PinyinCandidateWord> pendingPinyin_;
+    size_t customIndex_ = 0;
+    size_t pinyinIndex_ = 0;
+};
+
+// The pinyin sent to cloud pinyin for current input.
+std::string cloudPinyinInput(const libime::PinyinContext &context) {
+    if (context.useShuangpin()) {
+        return context.candidates().empty() ? std::string()
+                                            : context.candidateFullPinyin(0);
+    }
+    return context.userInput().substr(context.selectedLength());
+}
+
 } // namespace
 
 PinyinState::PinyinState(PinyinEngine *engine) : context_(engine->ime()) {
@@ -425,6 +514,24 @@ void PinyinEngine::updatePuncCandidate(
     inputContext->updateUserInterface(UserInterfaceComponent::InputPanel);
 }
 
+void PinyinEngine::learn(libime::PinyinContext &context) {
+    auto words = context.selectedWordsWithPinyin();
+    userDictChanged_ = false;
+    context.learn();
+    // Same as PinyinContext::learn, if the selected words are learned as a
+    // new word, history takes the whole sentence as one word.
+    if (userDictChanged_) {
+        std::string code;
+        for (const auto &word : words) {
+            code.append(word.second);
+        }
+        journal_.addWord(context.selectedFullPinyin(),
+                         context.selectedSentence());
+        words = {{context.selectedSentence(), std::move(code)}};
+    }
+    journal_.addHistory(words);
+}
+
 void PinyinEngine::updateUI(InputContext *inputContext) {
     auto *state = inputContext->propertyFor(&factory_);
     if (state->mode_ == PinyinMode::StrokeFilter) {
@@ -437,7 +544,7 @@ void PinyinEngine::updateUI(InputContext *inputContext) {
         auto sentence = context.sentence();
         if (!inputContext->capabilityFlags().testAny(
                 CapabilityFlag::PasswordOrSensitive)) {
-            state->context_.learn();
+            learn(state->context_);
         }
         inputContext->commitString(sentence);
         inputContext->updatePreedit();
@@ -461,7 +568,7 @@ void PinyinEngine::updateUI(InputContext *inputContext) {
         }
 
         // Setup candidate list.
-        auto candidateList = std::make_unique<CommonCandidateList>();
+        auto candidateList = std::make_unique<PinyinCandidateList>();
         candidateList->setPageSize(*config_.pageSize);
         candidateList->setCursorPositionAfterPaging(
             CursorPositionAfterPaging::ResetToFirst);
@@ -488,14 +595,25 @@ void PinyinEngine::updateUI(InputContext *inputContext) {
             if (!results) {
                 break;
             }
+            const CustomPhrase::Evaluator evaluator =
+                [this, inputContext](std::string_view key) {
+                    return evaluateCustomPhrase(inputContext, key);
+                };
+            // Builtin variables of all phrases share the same time.
+            std::optional<std::tm> time;
             for (const auto &result : *results) {
                 if (result.order() <= 0) {
                     continue;
                 }
-                auto phrase =
-                    result.evaluate([this, inputContext](std::string_view key) {
-                        return evaluateCustomPhrase(inputContext, key);
-                    });
+                std::string phrase;
+                if (result.isDynamic()) {
+                    if (!time) {
+                        time = CustomPhrase::currentTime();
+                    }
+                    phrase = result.evaluate(*time, evaluator);
+                } else {
+                    phrase = result.value();
+                }
                 if (customCandidateMap.contains(phrase)) {
                     continue;
                 }
@@ -516,23 +634,42 @@ void PinyinEngine::updateUI(InputContext *inputContext) {
             !inputContext->capabilityFlags().testAny(
                 CapabilityFlag::PasswordOrSensitive) &&
             fullResult) {
-            using namespace std::placeholders;
-            auto fullPinyin = context.useShuangpin()
-                                  ? context.candidateFullPinyin(0)
-                                  : context.userInput().substr(selectedLength);
-            auto cand = std::make_unique<CustomCloudPinyinCandidateWord>(
-                this, fullPinyin, selectedSentence, inputContext,
-                [this](InputContext *ic, const std::string &selected,
-                       const std::string &word) {
-                    cloudPinyinSelected(ic, selected, word);
-                },
-                CandidateOrder{*config_.cloudPinyinIndex - 1,
-                               customCandidateMap.size()});
-            if (!cand->filled() ||
-                (!cand->word().empty() &&
-                 !customCandidateMap.contains(cand->word()) &&
-                 !context.candidatesToCursorSet().contains(cand->word()))) {
-                customCandidateMap.emplace(cand->word(), std::move(cand));
+            auto fullPinyin = cloudPinyinInput(context);
+            // Results of the previous input are no longer needed.
+            cloudpinyin()->call<ICloudPinyin::cancel>(inputContext,
+                                                      fullPinyin);
+            // When prefetching, show the candidate once the result is fetched
+            // if user is still typing the same thing.
+            const bool prefetched =
+                cloudpinyin()->call<ICloudPinyin::prefetch>(
+                    inputContext, fullPinyin,
+                    [this, ref = inputContext->watch()](
+                        const std::string &pinyin, const std::string &hanzi) {
+                        auto *ic = ref.get();
+                        if (!ic || hanzi.empty() ||
+                            instance()->inputMethodEngine(ic) != this) {
+                            return;
+                        }
+                        auto *state = ic->propertyFor(&factory_);
+                        if (cloudPinyinInput(state->context_) == pinyin) {
+                            updateUI(ic);
+                        }
+                    });
+            if (!prefetched) {
+                auto cand = std::make_unique<CustomCloudPinyinCandidateWord>(
+                    this, fullPinyin, selectedSentence, inputContext,
+                    [this](InputContext *ic, const std::string &selected,
+                           const std::string &word) {
+                        cloudPinyinSelected(ic, selected, word);
+                    },
+                    CandidateOrder{*config_.cloudPinyinIndex - 1,
+                                   customCandidateMap.size()});
+                if (!cand->filled() ||
+                    (!cand->word().empty() &&
+                     !customCandidateMap.contains(cand->word()) &&
+                     !context.candidatesToCursorSet().contains(cand->word()))) {
+                    customCandidateMap.emplace(cand->word(), std::move(cand));
+                }
             }
         }
         /// }}}
@@ -612,112 +749,64 @@ void PinyinEngine::updateUI(InputContext *inputContext) {
         }
         /// }}}
 
-        const auto candidateCompare = [](const auto &lhs, const auto &rhs) {
-            return lhs->sortOrder() < rhs->sortOrder();
-        };
-
-        // Save the middle point for inplace_merge.
-        std::vector<std::unique_ptr<PinyinAbstractCandidateWord>> candidates;
-        std::unordered_map<std::string, std::vector<PinyinCandidateWord *>>
-            candidateSet;
-
-        for (size_t idx = 0; idx < pinyinCandidates.size(); ++idx) {
+        // Pinyin candidate that is the same as custom candidate takes the
+        // position of the custom one, and the rest with same text are
+        // dropped.
+        std::unordered_set<std::string_view> unmatchedWords;
+        for (const auto &[word, _] : customCandidateMap) {
+            if (context.candidatesToCursorSet().contains(word)) {
+                unmatchedWords.insert(word);
+            }
+        }
+        for (size_t idx = 0;
+             idx < pinyinCandidates.size() && !unmatchedWords.empty(); ++idx) {
             const auto &candidate = pinyinCandidates[idx];
             auto candidateString = candidate.toString();
-            auto iter = customCandidateMap.find(candidateString);
-            CandidateOrder order{idx, customCandidateMap.size()};
-            if (iter != customCandidateMap.end()) {
-                if (iter->second->selectLength() !=
-                    candidate.sentence().back()->to()->index()) {
-                    continue;
-                }
-                order = iter->second->sortOrder();
+            auto wordIter = unmatchedWords.find(candidateString);
+            if (wordIter == unmatchedWords.end()) {
+                continue;
             }
+            auto &customCandidate = customCandidateMap[candidateString];
+            const auto selectLength =
+                candidate.sentence().back()->to()->index();
+            if (customCandidate->selectLength() != selectLength) {
+                continue;
+            }
+            unmatchedWords.erase(wordIter);
             auto pinyinCandidate = std::make_unique<PinyinCandidateWord>(
                 this, inputContext, Text(std::move(candidateString)),
-                candidate.sentence().back()->to()->index(), idx, order);
-            candidateSet[pinyinCandidate->text().toString()].push_back(
-                pinyinCandidate.get());
-            if (iter != customCandidateMap.end()) {
-                if (dynamic_cast<CustomPhraseCandidateWord *>(
-                        iter->second.get())) {
-                    pinyinCandidate->setCustomPhrase();
-                }
-                iter->second = std::move(pinyinCandidate);
-            } else {
-                candidates.push_back(std::move(pinyinCandidate));
+                selectLength, idx, customCandidate->sortOrder());
+            if (dynamic_cast<CustomPhraseCandidateWord *>(
+                    customCandidate.get())) {
+                pinyinCandidate->setCustomPhrase();
             }
+            customCandidate = std::move(pinyinCandidate);
         }
-        for (const auto &[_, candidates] : candidateSet) {
-            for (auto *candidate : candidates | std::views::drop(1)) {
-                candidate->setPinyinInComment();
-            }
-        }
-        size_t middle = candidates.size();
-        for (auto &[_, candidate] : customCandidateMap) {
-            candidates.push_back(std::move(candidate));
-        }
-        // We expect stable sort here.
-        // Real pinyin candidate is always in order, so we have small N here.
-        std::stable_sort(std::ranges::next(candidates.begin(), middle),
-                         candidates.end(), candidateCompare);
-        std::ranges::inplace_merge(
-            candidates, std::ranges::next(candidates.begin(), middle),
-            candidateCompare);
-
-        // Apply the candidate to candidate generation.
-        for (auto &candidatePtr : candidates) {
-            // Candidate pointer shall still valid here.
-            auto *candidate = candidatePtr.get();
-            auto candidateString = candidate->text().toString();
-
-            std::vector<std::string> luaExtraCandidates;
-#ifdef FCITX_HAS_LUA
-            // Only trigger lua for top N candidates to avoid too much overhead.
-            if (candidate->order() <
-                    std::max<size_t>(*config_.nbest, *config_.pageSize) &&
-                imeapi()) {
-                luaExtraCandidates =
-                    luaCandidateTrigger(inputContext, candidateString);
-            }
-#endif
-
-            // use candidateString before it is moved.
-            const std::vector<std::string> *symbols = nullptr;
-            if (*config_.symbolsEnabled) {
-                symbols = symbols_.lookup(candidateString);
-            }
-
-            candidateList->append(std::move(candidatePtr));
-            for (auto &extraCandidate : luaExtraCandidates) {
-                candidateList->append<LuaCandidateWord>(
-                    this, candidate->selectLength(), std::move(extraCandidate));
-            }
 
-            if (symbols) {
-                std::string encodedPinyin;
-                int pinyinCandidateIndex = -1;
-                if (candidate->isPinyinCandidate()) {
-                    auto *pinyinCandidate =
-                        static_cast<PinyinCandidateWord *>(candidate);
-                    pinyinCandidateIndex = pinyinCandidate->candidateIndex();
-                    encodedPinyin = getEncodedPinyin(
-                        pinyinCandidates[pinyinCandidateIndex]);
+        // Only the first page and the next one are created here, so the first
+        // page does not depend on the number of candidates. The rest are
+        // generated page by page.
+        auto generator = std::make_shared<PinyinCandidateGenerator>(
+            this, inputContext, std::move(customCandidateMap));
+        const auto serial = ++state->candidateListSerial_;
+        const auto inputLength = pyBeforeCursor.size();
+        candidateList->setSelectionKey(selectionKeys_);
+        candidateList->setGenerator(
+            [this, inputContext, state, serial, inputLength,
+             generator](PinyinCandidateList *list) {
+                if (state->candidateListSerial_ != serial) {
+                    return false;
                 }
-                for (const auto &symbol : *symbols) {
-                    const bool isFull =
-                        candidate->selectLength() == pyBeforeCursor.size();
-                    candidateList->append<SymbolCandidateWord>(
-                        this, symbol, encodedPinyin, candidate->selectLength(),
-                        isFull, pinyinCandidateIndex);
+                auto candidate =
+                    generator->next(state->context_.candidatesToCursor());
+                if (!candidate) {
+                    return false;
                 }
-            }
-        }
-
-        candidateList->setSelectionKey(selectionKeys_);
-        if (!candidateList->empty()) {
-            candidateList->setGlobalCursorIndex(0);
-        }
+                appendCandidate(inputContext, list, std::move(candidate),
+                                inputLength);
+                return true;
+            },
+            *config_.pageSize * 2);
         candidateList->setActionableImpl(
             std::make_unique<PinyinActionableCandidateList>(this,
                                                             inputContext));
@@ -725,19 +814,67 @@ void PinyinEngine::updateUI(InputContext *inputContext) {
             std::make_unique<PinyinTabbedCandidateList>(this, inputContext,
                                                         candidateList.get()));
         inputPanel.setCandidateList(std::move(candidateList));
+        if (chttrans()) {
+            chttrans()->call<IChttrans::convertCandidateList>(inputContext);
+        }
     } while (0);
     inputContext->updatePreedit();
     inputContext->updateUserInterface(UserInterfaceComponent::InputPanel);
 }
 
-std::string PinyinEngine::evaluateCustomPhrase(InputContext *inputContext,
-                                               std::string_view key) {
-    FCITX_UNUSED(inputContext);
-    auto result = CustomPhrase::builtinEvaluator(key);
-    if (!result.empty()) {
-        return result;
+void PinyinEngine::appendCandidate(
+    InputContext *inputContext, PinyinCandidateList *candidateList,
+    std::unique_ptr<PinyinAbstractCandidateWord> candidatePtr,
+    size_t inputLength) {
+    auto *state = inputContext->propertyFor(&factory_);
+    // Candidate pointer shall still valid here.
+    auto *candidate = candidatePtr.get();
+    auto candidateString = candidate->text().toString();
+
+    std::vector<std::string> luaExtraCandidates;
+#ifdef FCITX_HAS_LUA
+    // Only trigger lua for top N candidates to avoid too much overhead.
+    if (candidate->order() <
+            std::max<size_t>(*config_.nbest, *config_.pageSize) &&
+        imeapi()) {
+        luaExtraCandidates =
+            luaCandidateTrigger(inputContext, candidateString);
+    }
+#endif
+
+    const std::vector<std::string> *symbols = nullptr;
+    if (*config_.symbolsEnabled) {
+        symbols = symbols_.lookup(candidateString);
+    }
+
+    candidateList->append(std::move(candidatePtr));
+    for (auto &extraCandidate : luaExtraCandidates) {
+        candidateList->append<LuaCandidateWord>(
+            this, candidate->selectLength(), std::move(extraCandidate));
+    }
+
+    if (symbols) {
+        std::string encodedPinyin;
+        int pinyinCandidateIndex = -1;
+        if (candidate->isPinyinCandidate()) {
+            auto *pinyinCandidate =
+                static_cast<PinyinCandidateWord *>(candidate);
+            pinyinCandidateIndex = pinyinCandidate->candidateIndex();
+            encodedPinyin = getEncodedPinyin(
+                state->context_.candidatesToCursor()[pinyinCandidateIndex]);
+        }
+        const bool isFull = candidate->selectLength() == inputLength;
+        for (const auto &symbol : *symbols) {
+            candidateList->append<SymbolCandidateWord>(
+                this, symbol, encodedPinyin, candidate->selectLength(), isFull,
+                pinyinCandidateIndex);
+        }
     }
+}
 
+std::string PinyinEngine::evaluateCustomPhrase(InputContext *inputContext,
+                                               std::string_view key) {
+    // Builtin variables are already resolved by CustomPhrase.
 #ifdef FCITX_HAS_LUA
     if (key.starts_with("lua:")) {
         RawConfig config;
@@ -747,13 +884,50 @@ std::string PinyinEngine::evaluateCustomPhrase(InputContext *inputContext,
             return ret.value();
         }
     }
+#else
+    FCITX_UNUSED(inputContext);
+    FCITX_UNUSED(key);
 #endif
     return "";
 }
 
+// Shared with worker thread, so custom phrase is never overwritten by an older
+// copy, no matter which thread writes it.
+struct PinyinEngine::CustomPhraseSaveState {
+    std::mutex mutex;
+    // Latest generation that is written or discarded.
+    uint64_t generation = 0;
+
+    bool save(uint64_t targetGeneration, const CustomPhraseDict &dict) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (targetGeneration <= generation) {
+            return true;
+        }
+        const bool result = StandardPaths::global().safeSave(
+            StandardPathsType::PkgData, "pinyin/customphrase",
+            [&dict](int fd) {
+                OFDStreamBuf buffer(fd);
+                std::ostream out(&buffer);
+                try {
+                    dict.save(out);
+                    return static_cast<bool>(out);
+                } catch (const std::exception &e) {
+                    PINYIN_ERROR()
+                        << "Failed to save custom phrase: " << e.what();
+                    return false;
+                }
+            });
+        if (result) {
+            generation = targetGeneration;
+        }
+        return result;
+    }
+};
+
 PinyinEngine::PinyinEngine(Instance *instance)
     : instance_(instance),
       factory_([this](InputContext &) { return new PinyinState(this); }),
+      customPhraseSaveState_(std::make_shared<CustomPhraseSaveState>()),
       worker_(instance->eventDispatcher()) {
     ime_ = std::make_unique<libime::PinyinIME>(
         std::make_unique<libime::PinyinDictionary>(),
@@ -807,6 +981,23 @@ PinyinEngine::PinyinEngine(Instance *instance)
             PINYIN_ERROR() << "Failed to load pinyin history: " << e.what();
         }
     } while (0);
+    journal_.setNeedCompactCallback([this]() {
+        // Journal may be changed in the middle of learning.
+        compactJournalEvent_ =
+            instance_->eventLoop().addDeferEvent([this](EventSource *) {
+                compactJournal();
+                compactJournalEvent_.reset();
+                return true;
+            });
+    });
+    journal_.load(ime_.get());
+    userDictChangedConn_ =
+        ime_->dict()->connect<libime::TrieDictionary::dictionaryChanged>(
+            [this](size_t index) {
+                if (index == libime::PinyinDictionary::UserDict) {
+                    userDictChanged_ = true;
+                }
+            });
 
     ime_->setScoreFilter(1);
     loadBuiltInDict();
@@ -889,7 +1080,16 @@ PinyinEngine::PinyinEngine(Instance *instance)
     });
 }
 
-PinyinEngine::~PinyinEngine() {}
+PinyinEngine::~PinyinEngine() {
+    flushCustomPhrase(/*wait=*/true);
+    flushUserData();
+    const auto stats = worker_.stats();
+    PINYIN_DEBUG() << "Worker thread stats. completed: " << stats.completed
+                   << " dropped: " << stats.dropped
+                   << " max depth: " << stats.maxQueueDepth
+                   << " max wait: " << stats.maxWaitTime.count() << "us"
+                   << " total run: " << stats.totalRunTime.count() << "us";
+}
 
 void PinyinEngine::loadSymbols(const UnixFD &file) {
     if (!file.isValid()) {
@@ -912,7 +1112,21 @@ void PinyinEngine::loadDict(const std::string &fullPath,
     }
     ime_->dict()->addEmptyDict();
     PINYIN_DEBUG() << "Loading pinyin dict " << fullPath;
+    auto loading = dictLoading_.lock();
+    if (!loading) {
+        loading = std::make_shared<bool>();
+        dictLoading_ = loading;
+    }
     std::packaged_task<libime::PinyinDictionary::TrieType()> task([fullPath]() {
+        // Read the whole file at once instead of going through stream buffer.
+        // Dictionaries can be replaced by user in place, so they are never
+        // mapped.
+        if (MappedFile file(fullPath, /*mayMap=*/false); file.isValid()) {
+            MappedFileStreamBuf buffer(file);
+            std::istream in(&buffer);
+            return libime::PinyinDictionary::load(
+                in, libime::PinyinDictFormat::Binary);
+        }
         std::ifstream in(fullPath, std::ios::in | std::ios::binary);
         auto trie = libime::PinyinDictionary::load(
             in, libime::PinyinDictFormat::Binary);
@@ -920,8 +1134,9 @@ void PinyinEngine::loadDict(const std::string &fullPath,
     });
     taskTokens.push_back(worker_.addTask(
         std::move(task),
-        [this, index = ime_->dict()->dictSize() - 1, fullPath](
+        [this, index = ime_->dict()->dictSize() - 1, fullPath, loading](
             std::shared_future<libime::PinyinDictionary::TrieType> &future) {
+            FCITX_UNUSED(loading);
             try {
                 PINYIN_DEBUG()
                     << "Load pinyin dict " << fullPath << " finished.";
@@ -991,6 +1206,9 @@ void PinyinEngine::loadExtraDict() {
 }
 
 void PinyinEngine::loadCustomPhrase() {
+    // File may be changed by others, e.g. the custom phrase editor, and it
+    // always wins.
+    discardCustomPhrase();
     const auto &standardPath = StandardPaths::global();
     auto file =
         standardPath.open(StandardPathsType::PkgData, "pinyin/customphrase");
@@ -999,13 +1217,45 @@ void PinyinEngine::loadCustomPhrase() {
         return;
     }
 
+    // Text file is always the source of truth, snapshot is only used if it
+    // is generated from the very same file.
+    struct stat source;
+    const bool hasSource = fstat(file.fd(), &source) == 0;
+    if (hasSource) {
+        auto snapshot = standardPath.openUser(StandardPathsType::PkgData,
+                                              CustomPhraseSnapshotPath,
+                                              O_RDONLY | O_CLOEXEC);
+        if (MappedFile mapped(snapshot.fd());
+            mapped.isValid() &&
+            customPhrase_.loadSnapshot(mapped.view(), source)) {
+            return;
+        }
+    }
+
     try {
         IFDStreamBuf buffer(file.fd());
         std::istream in(&buffer);
         customPhrase_.load(in, true);
     } catch (const std::exception &e) {
         PINYIN_ERROR() << e.what();
+        return;
     }
+    if (!hasSource) {
+        return;
+    }
+    standardPath.safeSave(
+        StandardPathsType::PkgData, CustomPhraseSnapshotPath,
+        [this, &source](int fd) {
+            OFDStreamBuf buffer(fd);
+            std::ostream out(&buffer);
+            try {
+                return customPhrase_.saveSnapshot(out, source);
+            } catch (const std::exception &e) {
+                PINYIN_ERROR()
+                    << "Failed to save custom phrase snapshot: " << e.what();
+                return false;
+            }
+        });
 }
 
 void PinyinEngine::populateConfig() {
@@ -1177,6 +1427,8 @@ void PinyinEngine::populateConfig() {
                                ? libime::PinyinDictFlag::NoFlag
                                : libime::PinyinDictFlag::Disabled);
 
+    worker_.setMaxThreads(*config_.dictLoadingThreads);
+
     pyConfig_ = config_;
 }
 
@@ -1498,6 +1750,23 @@ bool PinyinEngine::handleNextPage(KeyEvent &event) const {
     return false;
 }
 
+std::vector<std::string_view>
+PinyinEngine::candidateStrokes(const CandidateWord &candidate) {
+    std::vector<std::string_view> strokes;
+    auto str = candidate.text().toStringForCommit();
+    if (utf8::lengthValidated(str) == utf8::INVALID_LENGTH) {
+        return strokes;
+    }
+    for (auto chr : utf8::MakeUTF8CharRange(str)) {
+        auto stroke =
+            pinyinhelper()->call<IPinyinHelper::reverseLookupStrokeChar>(chr);
+        if (!stroke.empty()) {
+            strokes.push_back(stroke);
+        }
+    }
+    return strokes;
+}
+
 void PinyinEngine::updateFilter(InputContext *inputContext) {
     auto *state = inputContext->propertyFor(&factory_);
     auto &inputPanel = inputContext->inputPanel();
@@ -1521,6 +1790,15 @@ void PinyinEngine::updateFilter(InputContext *inputContext) {
             (!pinyinTabbed || !pinyinTabbed->checked())) {
             candidateList->clearFilter();
         } else {
+            // Filter need to be applied to all candidates.
+            if (auto *pinyinCandidateList =
+                    dynamic_cast<PinyinCandidateList *>(candidateList)) {
+                pinyinCandidateList->materializeAll();
+            }
+            if (state->strokeCacheList_.lock() != inputPanel.candidateList()) {
+                state->strokeCache_.clear();
+                state->strokeCacheList_ = inputPanel.candidateList();
+            }
             candidateList->setFilter([this, pinyinTabbed,
                                       state](const CandidateWord &candidate)
                                          -> bool {
@@ -1532,26 +1810,16 @@ void PinyinEngine::updateFilter(InputContext *inputContext) {
                     if (dynamic_cast<const StrokeCandidateWord *>(&candidate)) {
                         return false;
                     }
-                    auto str = candidate.text().toStringForCommit();
-                    if (auto length = utf8::lengthValidated(str);
-                        length != utf8::INVALID_LENGTH && length >= 1) {
-                        auto charRange = utf8::MakeUTF8CharRange(str);
-                        for (auto iter = std::begin(charRange),
-                                  end = std::end(charRange);
-                             iter != end; ++iter) {
-                            std::string chr(iter.charRange().first,
-                                            iter.charRange().second);
-                            auto stroke =
-                                pinyinhelper()
-                                    ->call<IPinyinHelper::reverseLookupStroke>(
-                                        chr);
-                            if (stroke.starts_with(
-                                    state->strokeBuffer_.userInput())) {
-                                return true;
-                            }
-                        }
+                    auto [iter, inserted] =
+                        state->strokeCache_.try_emplace(&candidate);
+                    if (inserted) {
+                        iter->second = candidateStrokes(candidate);
                     }
-                    return false;
+                    const auto &input = state->strokeBuffer_.userInput();
+                    return std::ranges::any_of(
+                        iter->second, [&input](std::string_view stroke) {
+                            return stroke.starts_with(input);
+                        });
                 }
                 return true;
             });
@@ -1634,9 +1902,11 @@ void PinyinEngine::forgetCandidate(InputContext *inputContext, size_t index) {
             auto py = state->context_.candidateFullPinyin(index);
             state->context_.ime()->dict()->removeWord(
                 libime::PinyinDictionary::UserDict, py, sentence.toString());
+            journal_.removeWord(py, sentence.toString());
         }
         for (const auto &word : sentence.sentence()) {
             state->context_.ime()->model()->history().forget(word->word());
+            journal_.forget(word->word());
         }
     }
     resetForgetCandidate(inputContext);
@@ -1647,21 +1917,58 @@ void PinyinEngine::forgetCandidate(InputContext *inputContext, size_t index) {
 }
 
 void PinyinEngine::saveCustomPhrase() {
-    instance_->eventDispatcher().scheduleWithContext(watch(), [this]() {
-        StandardPaths::global().safeSave(
-            StandardPathsType::PkgData, "pinyin/customphrase", [this](int fd) {
-                OFDStreamBuf buffer(fd);
-                std::ostream out(&buffer);
-                try {
-                    customPhrase_.save(out);
-                    return static_cast<bool>(out);
-                } catch (const std::exception &e) {
-                    PINYIN_ERROR()
-                        << "Failed to save custom phrase: " << e.what();
-                    return false;
-                }
+    customPhraseGeneration_ += 1;
+    const uint64_t time = now(CLOCK_MONOTONIC) + CustomPhraseSaveDelay;
+    if (!saveCustomPhraseEvent_) {
+        saveCustomPhraseEvent_ = instance_->eventLoop().addTimeEvent(
+            CLOCK_MONOTONIC, time, 0, [this](EventSourceTime *, uint64_t) {
+                flushCustomPhrase(/*wait=*/false);
+                return true;
             });
-    });
+    } else {
+        saveCustomPhraseEvent_->setTime(time);
+    }
+    saveCustomPhraseEvent_->setOneShot();
+}
+
+void PinyinEngine::flushCustomPhrase(bool wait) {
+    if (saveCustomPhraseEvent_) {
+        saveCustomPhraseEvent_->setEnabled(false);
+    }
+    const auto generation = customPhraseGeneration_;
+    if (wait) {
+        // Queued task is no longer needed, and the running one is waited by
+        // the lock.
+        saveCustomPhraseTask_.reset();
+        customPhraseSaveState_->save(generation, customPhrase_);
+        return;
+    }
+
+    // Copy is cheap compared to disk I/O, and it can be changed afterwards
+    // without affecting the write. Replacing the token also drops the
+    // previous task if it is not started yet.
+    std::packaged_task<bool()> task(
+        [state = customPhraseSaveState_, generation,
+         dict = std::make_shared<const CustomPhraseDict>(customPhrase_)]() {
+            return state->save(generation, *dict);
+        });
+    saveCustomPhraseTask_ = worker_.addTask(
+        std::move(task),
+        [](std::shared_future<bool> &future) {
+            if (!future.get()) {
+                PINYIN_ERROR() << "Failed to save custom phrase.";
+            }
+        },
+        TaskPriority::Background);
+}
+
+void PinyinEngine::discardCustomPhrase() {
+    if (saveCustomPhraseEvent_) {
+        saveCustomPhraseEvent_->setEnabled(false);
+    }
+    saveCustomPhraseTask_.reset();
+    std::lock_guard<std::mutex> lock(customPhraseSaveState_->mutex);
+    customPhraseSaveState_->generation = customPhraseGeneration_;
 }
 
 void PinyinEngine::pinCustomPhrase(InputContext *inputContext,
@@ -2311,9 +2618,12 @@ void PinyinEngine::setSubConfig(const std::string &path,
         loadExtraDict();
     } else if (path == "clearuserdict") {
         ime_->dict()->clear(libime::PinyinDictionary::UserDict);
+        journal_.clearUserDict();
     } else if (path == "clearalldict") {
         ime_->dict()->clear(libime::PinyinDictionary::UserDict);
         ime_->model()->history().clear();
+        journal_.clearUserDict();
+        journal_.clearHistory();
     } else if (path == "customphrase") {
         loadCustomPhrase();
     }
@@ -2345,24 +2655,32 @@ void PinyinEngine::doReset(InputContext *inputContext) const {
 
 void PinyinEngine::save() {
     safeSaveAsIni(config_, "conf/pinyin.conf");
-    const auto &standardPath = StandardPaths::global();
-    standardPath.safeSave(
-        StandardPathsType::PkgData, "pinyin/user.dict", [this](int fd) {
-            OFDStreamBuf buffer(fd);
-            std::ostream out(&buffer);
-            try {
-                ime_->dict()->save(libime::PinyinDictionary::UserDict, out,
-                                   libime::PinyinDictFormat::Binary);
-                return static_cast<bool>(out);
-            } catch (const std::exception &e) {
-                PINYIN_ERROR() << "Failed to save pinyin dict: " << e.what();
-                return false;
-            }
-        });
-    standardPath.safeSave(
-        StandardPathsType::PkgData, "pinyin/user.history", [this](int fd) {
-            OFDStreamBuf buffer(fd);
-            std::ostream out(&buffer);
+    flushCustomPhrase(/*wait=*/true);
+    compactJournal();
+}
+
+void PinyinEngine::compactJournal() {
+    // Changes since last compaction are already in the journal.
+    if (saveUserDataTask_ || !journal_.needCompact()) {
+        return;
+    }
+    // Journal is tied to user.history, user.dict is written first so the old
+    // user.history and journal are kept if user.dict can't be saved.
+    auto snapshot = userDataSaver_.snapshot();
+    if (!snapshot.add("pinyin/user.dict",
+                      [this](std::ostream &out) {
+                          try {
+                              ime_->dict()->save(
+                                  libime::PinyinDictionary::UserDict, out,
+                                  libime::PinyinDictFormat::Binary);
+                              return true;
+                          } catch (const std::exception &e) {
+                              PINYIN_ERROR() << "Failed to save pinyin dict: "
+                                             << e.what();
+                              return false;
+                          }
+                      }) ||
+        !snapshot.add("pinyin/user.history", [this](std::ostream &out) {
             try {
                 ime_->model()->save(out);
                 return true;
@@ -2370,7 +2688,46 @@ void PinyinEngine::save() {
                 PINYIN_ERROR() << "Failed to save pinyin history: " << e.what();
                 return false;
             }
+        })) {
+        return;
+    }
+
+    // Changes made while the snapshot is being written go to the journal as
+    // usual, and are kept when the journal is reset.
+    pendingJournalCheckpoint_ = journal_.checkpoint();
+    pendingUserData_ =
+        std::make_shared<const SnapshotSaver::Snapshot>(std::move(snapshot));
+    std::packaged_task<bool()> task(
+        [&saver = userDataSaver_, snapshot = pendingUserData_]() {
+            return saver.write(*snapshot);
         });
+    saveUserDataTask_ = worker_.addTask(
+        std::move(task),
+        [this](std::shared_future<bool> &future) {
+            userDataSaved(future.get());
+        },
+        TaskPriority::Background);
+}
+
+void PinyinEngine::flushUserData() {
+    if (!pendingUserData_) {
+        return;
+    }
+    // Queued task is no longer needed, and the running one is waited by the
+    // lock in saver.
+    saveUserDataTask_.reset();
+    userDataSaved(userDataSaver_.write(*pendingUserData_));
+}
+
+void PinyinEngine::userDataSaved(bool success) {
+    if (success) {
+        journal_.reset(pendingJournalCheckpoint_);
+    } else {
+        PINYIN_ERROR() << "Failed to save pinyin user data.";
+        journal_.markIncomplete();
+    }
+    saveUserDataTask_.reset();
+    pendingUserData_.reset();
 }
 
 std::string PinyinEngine::subMode(const InputMethodEntry &entry,
@@ -2540,6 +2897,7 @@ void PinyinEngine::cloudPinyinSelected(InputContext *inputContext,
                     std::string(encodedPinyin.data(), encodedPinyin.size())});
                 ime_->dict()->addWord(libime::PinyinDictionary::UserDict,
                                       joined, word);
+                journal_.addWord(joined, word);
             } else {
                 if (state->context_.useShuangpin()) {
                     bool end = false;
@@ -2569,11 +2927,13 @@ void PinyinEngine::cloudPinyinSelected(InputContext *inputContext,
                         joined, libime::PinyinFuzzyFlag::VE_UE);
                 ime_->dict()->addWord(libime::PinyinDictionary::UserDict,
                                       joined, wordView);
+                journal_.addWord(joined, wordView);
                 words.push_back(libime::HistoryBigram::WordWithCode{
                     std::string(wordView),
                     std::string(encodedPinyin.data(), encodedPinyin.size())});
             }
             ime_->model()->history().addWithCode(words);
+            journal_.addHistory(words);
         } catch (const std::exception &e) {
             PINYIN_DEBUG() << "Failed to save cloudpinyin: " << e.what();
         }
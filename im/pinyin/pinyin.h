@@ -7,7 +7,10 @@
 #ifndef _PINYIN_PINYIN_H_
 #define _PINYIN_PINYIN_H_
 
+#include "../../common/snapshotsaver.h"
 #include "customphrase.h"
+#include "learningjournal.h"
+#include "pinyin_public.h"
 #include "symboldictionary.h"
 #include "workerthread.h"
 #include <cstddef>
@@ -17,6 +20,7 @@
 #include <fcitx-config/iniparser.h>
 #include <fcitx-config/option.h>
 #include <fcitx-config/rawconfig.h>
+#include <fcitx-utils/connectableobject.h>
 #include <fcitx-utils/event.h>
 #include <fcitx-utils/eventloopinterface.h>
 #include <fcitx-utils/handlertable.h>
@@ -31,6 +35,7 @@
 #include <fcitx/action.h>
 #include <fcitx/addoninstance.h>
 #include <fcitx/addonmanager.h>
+#include <fcitx/candidatelist.h>
 #include <fcitx/event.h>
 #include <fcitx/inputcontext.h>
 #include <fcitx/inputcontextproperty.h>
@@ -49,6 +54,7 @@
 #include <regex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -367,10 +373,16 @@ FCITX_CONFIGURATION(
                               "matches any regular "
                               "expression from the list.")}}};
     Option<FuzzyConfig> fuzzyConfig{this, "Fuzzy", _("Fuzzy Pinyin")};
-    HiddenOption<bool> firstRun{this, "FirstRun", "FirstRun", true};)
+    HiddenOption<bool> firstRun{this, "FirstRun", "FirstRun", true};
+    // Number of threads to load dictionaries, 0 for automatic.
+    HiddenOption<int, IntConstrain> dictLoadingThreads{
+        this, "DictLoadingThreads", "DictLoadingThreads", 0,
+        IntConstrain(0, 64)};)
 
 struct EventSourceTime;
 class CandidateList;
+class PinyinAbstractCandidateWord;
+class PinyinCandidateList;
 class PinyinEngine;
 
 enum class PinyinMode { Normal, StrokeFilter, ForgetCandidate, Punctuation };
@@ -386,6 +398,11 @@ public:
 
     // Stroke filter
     InputBuffer strokeBuffer_;
+    // Strokes of the characters in each candidate, computed once per candidate
+    // list instead of on every stroke key.
+    std::weak_ptr<CandidateList> strokeCacheList_;
+    std::unordered_map<const CandidateWord *, std::vector<std::string_view>>
+        strokeCache_;
 
     // Forget candidate
     std::shared_ptr<CandidateList> forgetCandidateList_;
@@ -398,6 +415,10 @@ public:
     int keyReleased_ = -1;
     int keyReleasedIndex_ = -2;
     uint64_t lastKeyPressedTime_ = 0;
+
+    // Bumped whenever candidate list is rebuilt, so a stale list won't
+    // generate candidates from a changed context.
+    uint64_t candidateListSerial_ = 0;
 };
 
 class PinyinEngine final : public InputMethodEngineV3,
@@ -456,6 +477,8 @@ public:
 
     const auto &selectionKeys() const { return selectionKeys_; }
 
+    bool dictionaryLoaded() const { return dictLoading_.expired(); }
+
 private:
     void cloudPinyinSelected(InputContext *inputContext,
                              const std::string &selected,
@@ -481,6 +504,8 @@ private:
     void populateConfig();
 
     void updateForgetCandidate(InputContext *inputContext);
+    std::vector<std::string_view>
+    candidateStrokes(const CandidateWord &candidate);
 
     void updatePreedit(InputContext *inputContext) const;
     void updatePuncCandidate(InputContext *inputContext,
@@ -495,18 +520,42 @@ private:
     std::vector<std::string>
     luaCandidateTrigger(InputContext *ic, const std::string &candidateString);
 #endif
+    void appendCandidate(InputContext *inputContext,
+                         PinyinCandidateList *candidateList,
+                         std::unique_ptr<PinyinAbstractCandidateWord> candidate,
+                         size_t inputLength);
     void loadBuiltInDict();
     void loadExtraDict();
     void loadCustomPhrase();
     void loadSymbols(const UnixFD &file);
     void loadDict(const std::string &fullPath,
                   std::list<std::unique_ptr<TaskToken>> &taskTokens);
+    // Learn the selected sentence, and record the change to journal.
+    void learn(libime::PinyinContext &context);
+    // Save custom phrase after a short delay, so consecutive changes are
+    // written only once.
     void saveCustomPhrase();
+    // Write pending custom phrase changes. If wait is false, it is written by
+    // worker thread from a copy of the current dictionary.
+    void flushCustomPhrase(bool wait);
+    // Forget pending custom phrase changes.
+    void discardCustomPhrase();
+    // Fold the journal into user.dict and user.history if it is needed.
+    void compactJournal();
+    // Wait for the pending user.dict and user.history snapshot to be written.
+    void flushUserData();
+    void userDataSaved(bool success);
+
+    struct CustomPhraseSaveState;
 
     Instance *instance_;
     PinyinEngineConfig config_;
     PinyinEngineConfig pyConfig_;
     std::unique_ptr<libime::PinyinIME> ime_;
+    LearningJournal journal_;
+    // Set when user dictionary is changed, used to tell what is learned.
+    bool userDictChanged_ = false;
+    ScopedConnection userDictChangedConn_;
     std::vector<std::regex> quickphraseTriggerRegex_;
     KeyList selectionKeys_;
     KeyList numpadSelectionKeys_;
@@ -515,12 +564,27 @@ private:
     libime::PinyinPrediction prediction_;
     std::unique_ptr<EventSource> deferEvent_;
     std::unique_ptr<EventSource> deferredPreload_;
+    std::unique_ptr<EventSource> compactJournalEvent_;
     std::unique_ptr<HandlerTableEntry<EventHandler>> event_;
     CustomPhraseDict customPhrase_;
+    // Bumped whenever customPhrase_ is changed by the engine.
+    uint64_t customPhraseGeneration_ = 0;
+    std::shared_ptr<CustomPhraseSaveState> customPhraseSaveState_;
+    std::unique_ptr<EventSourceTime> saveCustomPhraseEvent_;
+    std::unique_ptr<TaskToken> saveCustomPhraseTask_;
+    // Used by worker thread, so it must outlive worker_.
+    SnapshotSaver userDataSaver_;
+    // user.dict and user.history being written by worker thread.
+    std::shared_ptr<const SnapshotSaver::Snapshot> pendingUserData_;
+    LearningJournal::Checkpoint pendingJournalCheckpoint_;
+    std::unique_ptr<TaskToken> saveUserDataTask_;
     SymbolDict symbols_;
     WorkerThread worker_;
     std::list<std::unique_ptr<TaskToken>> persistentTask_;
     std::list<std::unique_ptr<TaskToken>> tasks_;
+    // Held by the callback of each dictionary loading task, so it expires
+    // once all of them are either finished or dropped.
+    std::weak_ptr<void> dictLoading_;
 
     FCITX_ADDON_DEPENDENCY_LOADER(quickphrase, instance_->addonManager());
     FCITX_ADDON_DEPENDENCY_LOADER(fullwidth, instance_->addonManager());
@@ -531,6 +595,8 @@ private:
     FCITX_ADDON_DEPENDENCY_LOADER(spell, instance_->addonManager());
     FCITX_ADDON_DEPENDENCY_LOADER(imeapi, instance_->addonManager());
 
+    FCITX_ADDON_EXPORT_FUNCTION(PinyinEngine, dictionaryLoaded);
+
     static constexpr size_t NumBuiltInDict = 2;
 };
 
@@ -0,0 +1,15 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#ifndef _PINYIN_PINYIN_PUBLIC_H_
+#define _PINYIN_PINYIN_PUBLIC_H_
+
+#include <fcitx/addoninstance.h>
+
+// Whether all the dictionaries loaded by worker thread are ready.
+FCITX_ADDON_DECLARE_FUNCTION(PinyinEngine, dictionaryLoaded, bool());
+
+#endif // _PINYIN_PINYIN_PUBLIC_H_
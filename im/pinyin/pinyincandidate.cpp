@@ -32,6 +32,7 @@
 #include <libime/pinyin/pinyindictionary.h>
 #include <libime/pinyin/pinyinencoder.h>
 #include <libime/pinyin/shuangpinprofile.h>
+#include <limits>
 #include <map>
 #include <optional>
 #include <span>
@@ -65,6 +66,23 @@ using PinyinCache =
     std::unordered_map<PinyinCacheKey, std::optional<libime::PinyinSyllable>,
                        PinyinCacheKeyHash, std::equal_to<>>;
 
+// Make only the materialized candidates visible within the scope.
+class PartialViewGuard {
+public:
+    explicit PartialViewGuard(bool &partialView)
+        : partialView_(partialView), old_(partialView) {
+        partialView_ = true;
+    }
+    ~PartialViewGuard() { partialView_ = old_; }
+
+    PartialViewGuard(const PartialViewGuard &) = delete;
+    PartialViewGuard &operator=(const PartialViewGuard &) = delete;
+
+private:
+    bool &partialView_;
+    const bool old_;
+};
+
 // Helper function to produce the pinyin that matches the best to
 // the encoded candidate pinyin.
 std::optional<libime::PinyinSyllable>
@@ -396,6 +414,98 @@ void CustomCloudPinyinCandidateWord::select(InputContext *inputContext) const {
     CloudPinyinCandidateWord::select(inputContext);
 }
 
+void PinyinCandidateList::setGenerator(Generator generator,
+                                       int initialSize) {
+    generator_ = std::move(generator);
+    materialize(initialSize);
+    PartialViewGuard guard(partialView_);
+    if (!empty()) {
+        setGlobalCursorIndex(0);
+    }
+}
+
+void PinyinCandidateList::materialize(int size) {
+    if (!generator_ || partialView_) {
+        return;
+    }
+    PartialViewGuard guard(partialView_);
+    while (CommonCandidateList::totalSize() < size) {
+        if (!generator_(this)) {
+            generator_ = nullptr;
+            break;
+        }
+    }
+}
+
+void PinyinCandidateList::materializeAll() {
+    materialize(std::numeric_limits<int>::max());
+}
+
+void PinyinCandidateList::materializeToPage(int page) const {
+    // Keep one more page, so hasNext can be answered without generating.
+    const auto size = static_cast<int64_t>(page + 2) * pageSize();
+    // Candidates are only generated on demand, this does not change the
+    // observable content of the list.
+    const_cast<PinyinCandidateList *>(this)->materialize(
+        std::min<int64_t>(size, std::numeric_limits<int>::max()));
+}
+
+void PinyinCandidateList::ensureMaterialized() const {
+    if (generator_ && !partialView_) {
+        const_cast<PinyinCandidateList *>(this)->materializeAll();
+    }
+}
+
+void PinyinCandidateList::next() {
+    materializeToPage(currentPage() + 1);
+    PartialViewGuard guard(partialView_);
+    CommonCandidateList::next();
+}
+
+int PinyinCandidateList::totalPages() const {
+    ensureMaterialized();
+    return CommonCandidateList::totalPages();
+}
+
+void PinyinCandidateList::setPage(int page) {
+    materializeToPage(page);
+    PartialViewGuard guard(partialView_);
+    CommonCandidateList::setPage(page);
+}
+
+void PinyinCandidateList::prevCandidate() {
+    // Moving backward from the first candidate wraps to the last one.
+    if (globalCursorIndex() <= 0) {
+        ensureMaterialized();
+    }
+    PartialViewGuard guard(partialView_);
+    CommonCandidateList::prevCandidate();
+}
+
+void PinyinCandidateList::nextCandidate() {
+    materializeToPage(currentPage() + 1);
+    PartialViewGuard guard(partialView_);
+    CommonCandidateList::nextCandidate();
+}
+
+bool PinyinCandidateList::hasNext() const {
+    materializeToPage(currentPage());
+    PartialViewGuard guard(partialView_);
+    return CommonCandidateList::hasNext();
+}
+
+const CandidateWord &PinyinCandidateList::candidateFromAll(int idx) const {
+    if (idx >= CommonCandidateList::totalSize()) {
+        const_cast<PinyinCandidateList *>(this)->materialize(idx + 1);
+    }
+    return CommonCandidateList::candidateFromAll(idx);
+}
+
+int PinyinCandidateList::totalSize() const {
+    ensureMaterialized();
+    return CommonCandidateList::totalSize();
+}
+
 enum { PINYIN_FORGET, PINYIN_CUSTOMPHRASE, PINYIN_DELETE_CUSTOMPHRASE };
 
 PinyinActionableCandidateList::PinyinActionableCandidateList(
@@ -480,7 +590,7 @@ void PinyinActionableCandidateList::triggerAction(
 
 PinyinTabbedCandidateList::PinyinTabbedCandidateList(
     PinyinEngine *engine, InputContext *inputContext,
-    CommonCandidateList *candidateList)
+    PinyinCandidateList *candidateList)
     : engine_(engine), inputContext_(inputContext),
       candidateList_(candidateList) {}
 
@@ -518,6 +628,7 @@ void PinyinTabbedCandidateList::buildTabActions() {
 
     PinyinCache cache;
 
+    candidateList_->materializeAll();
     for (size_t i = 0; i < candidateList_->originSize(); i++) {
         const auto *candidate = &candidateList_->originCandidate(i);
         const auto *pinyinCandidate =
@@ -18,6 +18,7 @@
 #include <fcitx/candidatelist.h>
 #include <fcitx/inputcontext.h>
 #include <fcitx/text.h>
+#include <functional>
 #include <libime/core/lattice.h>
 #include <memory>
 #include <optional>
@@ -250,6 +251,41 @@ private:
     static constexpr uint64_t TickPeriod = 180000;
 };
 
+// Candidate list that only materializes the current page and the next one,
+// the rest are produced by the generator when user pages the list. Accessing
+// the list as a whole materializes everything.
+class PinyinCandidateList : public CommonCandidateList {
+public:
+    // Append one or more candidates to the list, return false if there is no
+    // more candidate.
+    using Generator = std::function<bool(PinyinCandidateList *)>;
+
+    // Generate candidates until there are at least initialSize of them and
+    // keep the generator for the rest. Cursor is set to the first candidate.
+    void setGenerator(Generator generator, int initialSize);
+
+    void materializeAll();
+
+    void next() override;
+    int totalPages() const override;
+    void setPage(int page) override;
+    void prevCandidate() override;
+    void nextCandidate() override;
+    bool hasNext() const override;
+    const CandidateWord &candidateFromAll(int idx) const override;
+    int totalSize() const override;
+
+private:
+    void materialize(int size);
+    void materializeToPage(int page) const;
+    void ensureMaterialized() const;
+
+    Generator generator_;
+    // Set when only the materialized candidates should be visible, e.g. when
+    // generator is appending candidates.
+    mutable bool partialView_ = false;
+};
+
 class PinyinActionableCandidateList : public ActionableCandidateList {
 public:
     PinyinActionableCandidateList(PinyinEngine *engine,
@@ -292,7 +328,7 @@ private:
 class PinyinTabbedCandidateList : public TabbedCandidateList {
 public:
     PinyinTabbedCandidateList(PinyinEngine *engine, InputContext *inputContext,
-                              CommonCandidateList *candidateList);
+                              PinyinCandidateList *candidateList);
 
     std::span<const CandidateAction> tabActions() override;
 
@@ -325,7 +361,7 @@ private:
 
     PinyinEngine *engine_;
     InputContext *inputContext_;
-    CommonCandidateList *candidateList_;
+    PinyinCandidateList *candidateList_;
 
     // Lazily initialized actions, since it requires scan all actions.
     std::optional<std::vector<CandidateAction>> actions_;
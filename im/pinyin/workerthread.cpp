@@ -5,14 +5,27 @@
  *
  */
 #include "workerthread.h"
+#include <algorithm>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <fcitx-utils/eventdispatcher.h>
 #include <memory>
 #include <mutex>
 #include <thread>
 
-WorkerThread::WorkerThread(fcitx::EventDispatcher &dispatcher)
-    : dispatcher_(dispatcher), thread_(&WorkerThread::runThread, this) {}
+namespace {
+
+// Tasks are mostly dictionary loading, which is bounded by memory bandwidth
+// more than CPU, so there is little gain beyond a few threads.
+constexpr size_t MaxDefaultThreads = 4;
+
+} // namespace
+
+WorkerThread::WorkerThread(fcitx::EventDispatcher &dispatcher,
+                           size_t maxThreads)
+    : dispatcher_(dispatcher),
+      maxThreads_(maxThreads ? maxThreads : defaultMaxThreads()) {}
 
 WorkerThread::~WorkerThread() {
     // Unlike other thread, there is no need to use a event loop  since there is
@@ -20,42 +33,109 @@ WorkerThread::~WorkerThread() {
     {
         std::lock_guard<std::mutex> lock(mutex_);
         exit_ = true;
-        condition_.notify_one();
+        condition_.notify_all();
     }
-    if (thread_.joinable()) {
-        thread_.join();
+    for (auto &thread : threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
     }
 }
 
+size_t WorkerThread::defaultMaxThreads() {
+    return std::clamp<size_t>(std::thread::hardware_concurrency(), 1,
+                              MaxDefaultThreads);
+}
+
+void WorkerThread::setMaxThreads(size_t maxThreads) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxThreads_ = maxThreads ? maxThreads : defaultMaxThreads();
+}
+
+size_t WorkerThread::maxThreads() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return maxThreads_;
+}
+
+WorkerThreadStats WorkerThread::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto stats = stats_;
+    stats.queueDepth = queueSize_;
+    return stats;
+}
+
 std::unique_ptr<TaskToken>
 WorkerThread::addTaskImpl(std::function<void()> task,
-                          std::function<void()> onDone) {
+                          std::function<void()> onDone, TaskPriority priority) {
     // Return an empty TrackableObject, so the unneeded task can be thrown away
     // by simply delete TaskToken.
     auto token = std::make_unique<TaskToken>();
     std::lock_guard<std::mutex> lock(mutex_);
-    queue_.push({.task = std::move(task),
-                 .callback = std::move(onDone),
-                 .context = token->watch()});
-    condition_.notify_one();
+    queues_[static_cast<size_t>(priority)].push(
+        {.task = std::move(task),
+         .callback = std::move(onDone),
+         .context = token->watch(),
+         .submitTime = std::chrono::steady_clock::now()});
+    queueSize_ += 1;
+    stats_.maxQueueDepth = std::max(stats_.maxQueueDepth, queueSize_);
+    // Start a new thread only if all existing ones are busy.
+    if (idleThreads_ < queueSize_ && threads_.size() < maxThreads_) {
+        threads_.emplace_back(&WorkerThread::runThread, this);
+    } else {
+        condition_.notify_one();
+    }
     return token;
 }
 
+bool WorkerThread::popTask(Task &task) {
+    for (auto &queue : queues_) {
+        while (!queue.empty()) {
+            task = std::move(queue.front());
+            queue.pop();
+            queueSize_ -= 1;
+            // Nobody is waiting for the result, e.g. dictionary is reloaded
+            // before the old load starts.
+            if (!task.context.isValid()) {
+                stats_.dropped += 1;
+                continue;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
 void WorkerThread::run() {
     while (true) {
         Task task;
         {
             std::unique_lock lock(mutex_);
-            condition_.wait(lock, [this] { return exit_ || !queue_.empty(); });
+            idleThreads_ += 1;
+            condition_.wait(lock, [this] { return exit_ || queueSize_ > 0; });
+            idleThreads_ -= 1;
             if (exit_) {
                 break;
             }
 
-            task = std::move(queue_.front());
-            queue_.pop();
+            if (!popTask(task)) {
+                continue;
+            }
         }
+        const auto start = std::chrono::steady_clock::now();
         // Run the actual task.
         task.task();
+        const auto end = std::chrono::steady_clock::now();
+        {
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto waitTime =
+                duration_cast<microseconds>(start - task.submitTime);
+            stats_.completed += 1;
+            stats_.totalWaitTime += waitTime;
+            stats_.maxWaitTime = std::max(stats_.maxWaitTime, waitTime);
+            stats_.totalRunTime += duration_cast<microseconds>(end - start);
+        }
         dispatcher_.scheduleWithContext(std::move(task.context),
                                         std::move(task.callback));
     }
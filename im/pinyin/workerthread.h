@@ -7,7 +7,11 @@
 #ifndef _PINYIN_WORKERTHREAD_H_
 #define _PINYIN_WORKERTHREAD_H_
 
+#include <array>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <fcitx-utils/eventdispatcher.h>
 #include <fcitx-utils/macros.h>
 #include <fcitx-utils/trackableobject.h>
@@ -17,17 +21,54 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <thread>
+#include <vector>
 
 class TaskToken : public fcitx::TrackableObject<TaskToken> {};
 
+// Tasks with higher priority are always picked first, tasks with the same
+// priority run in the order of submission. Normal is for the tasks that the
+// user is waiting for, e.g. loading dictionaries, and Background is for the
+// ones that can be delayed, e.g. saving user data.
+enum class TaskPriority { Normal, Background };
+
+struct WorkerThreadStats {
+    // Number of tasks waiting in the queue.
+    size_t queueDepth = 0;
+    size_t maxQueueDepth = 0;
+    uint64_t completed = 0;
+    // Tasks dropped before running since their token is destroyed.
+    uint64_t dropped = 0;
+    // Time between submission and start of the task.
+    std::chrono::microseconds totalWaitTime{0};
+    std::chrono::microseconds maxWaitTime{0};
+    std::chrono::microseconds totalRunTime{0};
+};
+
+// A bounded pool of worker threads. Threads are started on demand when there
+// is no idle thread, up to maxThreads. Callback of the task is delivered to
+// the thread of dispatcher.
 class WorkerThread {
 public:
-    WorkerThread(fcitx::EventDispatcher &dispatcher);
+    WorkerThread(fcitx::EventDispatcher &dispatcher, size_t maxThreads = 0);
     ~WorkerThread();
 
+    // Default number of threads, based on hardware concurrency.
+    static size_t defaultMaxThreads();
+
+    // Set the number of threads, 0 for default. Running threads are not
+    // stopped if the number is decreased.
+    void setMaxThreads(size_t maxThreads);
+    size_t maxThreads() const;
+
+    WorkerThreadStats stats() const;
+
+    // Task is dropped without running if the returned token is destroyed
+    // before the task is started.
     template <typename Ret, typename OnDone>
     FCITX_NODISCARD std::unique_ptr<TaskToken>
-    addTask(std::packaged_task<Ret()> task, OnDone onDone) {
+    addTask(std::packaged_task<Ret()> task, OnDone onDone,
+            TaskPriority priority = TaskPriority::Normal) {
         // Wrap packaged_task and future in shared, since std::function require
         // copy-able. The reason that we wrap it with in the std::function is
         // because we need type erasure to store it.
@@ -40,12 +81,14 @@ public:
                 onDone(future);
             };
 
-        return addTaskImpl(std::move(taskFunction), std::move(callback));
+        return addTaskImpl(std::move(taskFunction), std::move(callback),
+                           priority);
     }
 
 private:
     std::unique_ptr<TaskToken> addTaskImpl(std::function<void()> task,
-                                           std::function<void()> onDone);
+                                           std::function<void()> onDone,
+                                           TaskPriority priority);
     static void runThread(WorkerThread *self) { self->run(); }
     void run();
 
@@ -53,17 +96,25 @@ private:
         std::function<void()> task;
         std::function<void()> callback;
         fcitx::TrackableObjectReference<TaskToken> context;
+        std::chrono::steady_clock::time_point submitTime;
     };
 
+    static constexpr size_t NumPriorities =
+        static_cast<size_t>(TaskPriority::Background) + 1;
+
+    // Pop the first task that is still wanted, mutex_ must be held.
+    bool popTask(Task &task);
+
     fcitx::EventDispatcher &dispatcher_;
-    std::mutex mutex_;
-    std::queue<Task, std::list<Task>> queue_;
+    mutable std::mutex mutex_;
+    std::array<std::queue<Task, std::list<Task>>, NumPriorities> queues_;
+    size_t queueSize_ = 0;
+    WorkerThreadStats stats_;
     bool exit_ = false;
     std::condition_variable condition_;
-
-    // Must be the last member, since we did not use a smart pointer to wrap it.
-    // The thread will be started right away at the end of constructor.
-    std::thread thread_;
+    size_t maxThreads_;
+    size_t idleThreads_ = 0;
+    std::vector<std::thread> threads_;
 };
 
 #endif
@@ -102,6 +102,9 @@ TableIME::requestDict(const std::string &name) {
     auto iter = tables_.find(name);
     if (iter == tables_.end()) {
         TABLE_DEBUG() << "Load table config for: " << name;
+        // Table may be released just now, and its user data is still being
+        // written.
+        saver_.wait();
         iter = tables_
                    .emplace(std::piecewise_construct, std::make_tuple(name),
                             std::make_tuple())
@@ -220,8 +223,18 @@ TableIME::requestDict(const std::string &name) {
 }
 
 void TableIME::saveAll() {
+    // All tables are written by a single thread, failing to write one of them
+    // doesn't stop the others.
+    auto snapshot = saver_.snapshot(SnapshotSaver::OnFailure::Continue);
     for (const auto &p : tables_) {
-        saveDict(p.first);
+        snapshotDict(p.first, snapshot);
+    }
+    saver_.writeAsync(std::move(snapshot));
+}
+
+void TableIME::markDirty(const std::string &name) {
+    if (auto iter = tables_.find(name); iter != tables_.end()) {
+        iter->second.dirty = true;
     }
 }
 
@@ -241,52 +254,58 @@ void TableIME::updateConfig(const std::string &name, const RawConfig &config) {
 }
 
 void TableIME::releaseUnusedDict(const std::unordered_set<std::string> &names) {
+    auto snapshot = saver_.snapshot(SnapshotSaver::OnFailure::Continue);
     for (auto iter = tables_.begin(); iter != tables_.end();) {
         if (!names.contains(iter->first)) {
             TABLE_DEBUG() << "Release unused table: " << iter->first;
-            saveDict(iter->first);
+            snapshotDict(iter->first, snapshot);
             iter = tables_.erase(iter);
         } else {
             ++iter;
         }
     }
+    saver_.writeAsync(std::move(snapshot));
 }
 
 void TableIME::saveDict(const std::string &name) {
+    auto snapshot = saver_.snapshot(SnapshotSaver::OnFailure::Continue);
+    snapshotDict(name, snapshot);
+    saver_.writeAsync(std::move(snapshot));
+}
+
+void TableIME::snapshotDict(const std::string &name,
+                            SnapshotSaver::Snapshot &snapshot) {
     auto iter = tables_.find(name);
     if (iter == tables_.end()) {
         return;
     }
     libime::TableBasedDictionary *dict = iter->second.dict.get();
     libime::UserLanguageModel *lm = iter->second.model.get();
-    if (!dict || !lm || !*iter->second.root.config->learning) {
+    if (!dict || !lm || !*iter->second.root.config->learning ||
+        !iter->second.dirty) {
         return;
     }
+    // Saver still skips the file if the content turns out to be the same.
+    iter->second.dirty = false;
     auto fileName = stringutils::joinPath("table", name);
 
-    StandardPaths::global().safeSave(StandardPathsType::PkgData,
-                                     fileName + ".user.dict", [dict](int fd) {
-                                         OFDStreamBuf buffer(fd);
-                                         std::ostream out(&buffer);
-                                         try {
-                                             dict->saveUser(out);
-                                             return static_cast<bool>(out);
-                                         } catch (const std::exception &) {
-                                             return false;
-                                         }
-                                     });
-
-    StandardPaths::global().safeSave(StandardPathsType::PkgData,
-                                     fileName + ".history", [lm](int fd) {
-                                         OFDStreamBuf buffer(fd);
-                                         std::ostream out(&buffer);
-                                         try {
-                                             lm->save(out);
-                                             return static_cast<bool>(out);
-                                         } catch (const std::exception &) {
-                                             return false;
-                                         }
-                                     });
+    snapshot.add(fileName + ".user.dict", [dict](std::ostream &out) {
+        try {
+            dict->saveUser(out);
+            return true;
+        } catch (const std::exception &) {
+            return false;
+        }
+    });
+
+    snapshot.add(fileName + ".history", [lm](std::ostream &out) {
+        try {
+            lm->save(out);
+            return true;
+        } catch (const std::exception &) {
+            return false;
+        }
+    });
 }
 
 void TableIME::reloadAllDict() {
@@ -295,6 +314,7 @@ void TableIME::reloadAllDict() {
         names.insert(pair.first);
     }
     tables_.clear();
+    saver_.wait();
     for (const auto &name : names) {
         requestDict(name);
     }
@@ -7,6 +7,7 @@
 #ifndef _TABLE_TABLEDICTRESOLVER_H_
 #define _TABLE_TABLEDICTRESOLVER_H_
 
+#include "../../common/snapshotsaver.h"
 #include <fcitx-config/configuration.h>
 #include <fcitx-config/enum.h>
 #include <fcitx-config/option.h>
@@ -327,6 +328,8 @@ struct TableData {
     TableConfigRoot root;
     std::unique_ptr<libime::TableBasedDictionary> dict;
     std::unique_ptr<libime::UserLanguageModel> model;
+    // User dictionary or history is changed since it is last saved.
+    bool dirty = false;
 };
 
 class TableIME {
@@ -338,16 +341,24 @@ public:
     std::tuple<libime::TableBasedDictionary *, libime::UserLanguageModel *,
                const TableConfig *>
     requestDict(const std::string &name);
+    // User dictionary and history are written in background.
     void saveDict(const std::string &name);
     void saveAll();
+    // Called when user dictionary or history of the table is changed, clean
+    // tables are not saved.
+    void markDirty(const std::string &name);
     void updateConfig(const std::string &name, const RawConfig &config);
 
     void releaseUnusedDict(const std::unordered_set<std::string> &names);
     void reloadAllDict();
 
 private:
+    void snapshotDict(const std::string &name,
+                      SnapshotSaver::Snapshot &snapshot);
+
     libime::LanguageModelResolver *lm_;
     std::unordered_map<std::string, TableData> tables_;
+    SnapshotSaver saver_;
 };
 
 FCITX_DECLARE_LOG_CATEGORY(table_logcategory);
@@ -6,6 +6,7 @@
  */
 #include "state.h"
 #include "candidate.h"
+#include "chttrans_public.h"
 #include "context.h"
 #include "engine.h"
 #include "ime.h"
@@ -68,6 +69,8 @@ void TableState::release() {
     context_.reset();
 }
 
+void TableState::markDirty() { engine_->ime()->markDirty(lastContext_); }
+
 std::string TableState::commitSegements(size_t from, size_t to) {
     auto *context = context_.get();
     if (!context) {
@@ -131,6 +134,7 @@ void TableState::pushLastCommit(const std::string &code,
         TABLE_DEBUG() << "learnAutoPhrase " << autoPhraseBuffer_ << " "
                       << singleCharString << codeHints;
         context_->learnAutoPhrase(singleCharString, codeHints);
+        markDirty();
     } else {
         autoPhraseBuffer_.clear();
     }
@@ -588,6 +592,7 @@ bool TableState::handleLookupPinyinOrModifyDictionaryMode(KeyEvent &event) {
                 if (wordFlag == libime::PhraseFlag::Invalid) {
                     context_->mutableDict().insert(result, subString.first,
                                                    libime::PhraseFlag::User);
+                    markDirty();
                     reset();
                     return true;
                 }
@@ -595,6 +600,7 @@ bool TableState::handleLookupPinyinOrModifyDictionaryMode(KeyEvent &event) {
                     context_->mutableDict().removeWord(result, subString.first);
                     context_->mutableDict().insert(result, subString.first,
                                                    libime::PhraseFlag::User);
+                    markDirty();
                     reset();
                 }
             }
@@ -617,6 +623,7 @@ bool TableState::handleLookupPinyinOrModifyDictionaryMode(KeyEvent &event) {
                                                            subString.first);
                     }
                     context_->mutableModel().history().forget(subString.first);
+                    markDirty();
                     reset();
                     return true;
                 }
@@ -737,6 +744,7 @@ void TableState::forgetCandidateWord(size_t idx) {
         commitBuffer(false);
         context_->mutableDict().removeWord(code, word);
         context_->mutableModel().history().forget(word);
+        markDirty();
     } else {
         return;
     }
@@ -1264,6 +1272,7 @@ void TableState::commitBuffer(bool commitCode, bool noRealCommit) {
         (!*context->config().commitAfterSelect ||
          *context->config().useContextBasedOrder)) {
         context->learn();
+        markDirty();
     }
     context->clear();
 }
@@ -1288,6 +1297,7 @@ void TableState::commitAfterSelect(int commitFrom) {
         if (!ic_->capabilityFlags().testAny(
                 CapabilityFlag::PasswordOrSensitive)) {
             context->learnLast();
+            markDirty();
         }
     }
 }
@@ -1359,6 +1369,9 @@ void TableState::updateUI(bool keepOldCursor, bool maybePredict) {
             candidateList->setActionableImpl(
                 std::make_unique<TableActionableCandidateList>(this));
             inputPanel.setCandidateList(std::move(candidateList));
+            if (auto *chttrans = engine_->chttrans()) {
+                chttrans->call<IChttrans::convertCandidateList>(ic_);
+            }
         }
         const bool useClientPreedit =
             ic_->capabilityFlags().test(CapabilityFlag::Preedit);
@@ -91,6 +91,8 @@ private:
     bool autoSelectCandidate() const;
 
     bool isComposeTableMode() const;
+    // User dictionary or history of current table is changed.
+    void markDirty();
 
     std::unique_ptr<CandidateList>
     predictCandidateList(const std::vector<std::string> &words);
@@ -6,6 +6,8 @@
  */
 #include "chttrans-native.h"
 #include "chttrans.h"
+#include "gbks2t.h"
+#include <cstddef>
 #include <cstdint>
 #include <fcitx-utils/fdstreambuf.h>
 #include <fcitx-utils/standardpaths.h>
@@ -19,11 +21,37 @@
 
 using namespace fcitx;
 
+CodepointTable::CodepointTable() : pages_(1) {
+    directory_.fill(0);
+    pages_[0].fill(0);
+}
+
+void CodepointTable::insert(uint32_t from, uint32_t to) {
+    if (from >= MaxCodepoint || to == 0) {
+        return;
+    }
+    auto &pageIndex = directory_[from >> PageBits];
+    if (pageIndex == 0) {
+        pageIndex = static_cast<uint16_t>(pages_.size());
+        pages_.emplace_back().fill(0);
+    }
+    auto &value = pages_[pageIndex][from & PageMask];
+    if (value == 0) {
+        value = to;
+        size_ += 1;
+    }
+}
+
 bool NativeBackend::loadOnce(const ChttransConfig & /*unused*/) {
-    auto file =
-        StandardPaths::global().open(StandardPathsType::PkgData, TABLE_GBKS2T);
+    // The table is built into the addon, but user may still override it.
+    auto file = StandardPaths::global().openUser(StandardPathsType::PkgData,
+                                                 TABLE_GBKS2T);
     if (!file.isValid()) {
-        return false;
+        for (const auto &[simp, trad] : GBKS2TTable) {
+            s2tTable_.insert(simp, trad);
+            t2sTable_.insert(trad, simp);
+        }
+        return true;
     }
 
     IFDStreamBuf buffer(file.fd());
@@ -37,42 +65,48 @@ bool NativeBackend::loadOnce(const ChttransConfig & /*unused*/) {
         uint32_t trad;
 
         auto tradStart = utf8::getNextChar(simpStart, strBuf.end(), &simp);
-        auto end = utf8::getNextChar(tradStart, strBuf.end(), &trad);
+        utf8::getNextChar(tradStart, strBuf.end(), &trad);
         if (!utf8::isValidChar(simp) || !utf8::isValidChar(trad)) {
             continue;
         }
-        std::string_view simpView(simpStart, tradStart);
-        std::string_view tradView(tradStart, end);
-        s2tMap_.try_emplace(std::string(simpView), tradView);
-        t2sMap_.try_emplace(std::string(tradView), simpView);
+        s2tTable_.insert(simp, trad);
+        t2sTable_.insert(trad, simp);
     }
     return true;
 }
 
-std::string convert(const NativeBackend::MapType &transMap,
-                    const std::string &strHZ) {
-    auto len = utf8::lengthValidated(strHZ);
-    if (len == utf8::INVALID_LENGTH) {
-        return strHZ;
-    }
-    auto range = fcitx::utf8::MakeUTF8StringViewRange(strHZ);
-    std::string result;
-    for (const auto &value : range) {
-        auto iter = transMap.find(value);
-        if (iter != transMap.end()) {
-            result.append(iter->second);
-        } else {
-            result.append(value);
-        }
-    }
+std::string NativeBackend::convert(const CodepointTable &table,
+                                   const std::string &str) {
+    return convert(table, str, [](std::string_view, std::string &) {
+        return static_cast<size_t>(0);
+    });
+}
 
-    return result;
+void NativeBackend::appendUTF8(std::string &str, uint32_t code) {
+    if (code < 0x80) {
+        str.push_back(static_cast<char>(code));
+    } else if (code < 0x800) {
+        const char buf[] = {static_cast<char>(0xC0 | (code >> 6)),
+                            static_cast<char>(0x80 | (code & 0x3F))};
+        str.append(buf, sizeof(buf));
+    } else if (code < 0x10000) {
+        const char buf[] = {static_cast<char>(0xE0 | (code >> 12)),
+                            static_cast<char>(0x80 | ((code >> 6) & 0x3F)),
+                            static_cast<char>(0x80 | (code & 0x3F))};
+        str.append(buf, sizeof(buf));
+    } else {
+        const char buf[] = {static_cast<char>(0xF0 | (code >> 18)),
+                            static_cast<char>(0x80 | ((code >> 12) & 0x3F)),
+                            static_cast<char>(0x80 | ((code >> 6) & 0x3F)),
+                            static_cast<char>(0x80 | (code & 0x3F))};
+        str.append(buf, sizeof(buf));
+    }
 }
 
-std::string NativeBackend::convertSimpToTrad(const std::string &strHZ) {
-    return convert(s2tMap_, strHZ);
+std::string NativeBackend::doSimpToTrad(const std::string &strHZ) {
+    return convert(s2tTable_, strHZ);
 }
 
-std::string NativeBackend::convertTradToSimp(const std::string &strHZ) {
-    return convert(t2sMap_, strHZ);
+std::string NativeBackend::doTradToSimp(const std::string &strHZ) {
+    return convert(t2sTable_, strHZ);
 }
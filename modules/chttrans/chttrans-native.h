@@ -8,33 +8,114 @@
 #define _CHTTRANS_CHTTRANS_NATIVE_H_
 
 #include "chttrans.h"
-#include <functional>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fcitx-utils/utf8.h>
 #include <string>
 #include <string_view>
-#include <unordered_map>
+#include <vector>
 
-class NativeBackend : public ChttransBackend {
-    struct string_hash {
-        using is_transparent = void;
+// Codepoint to codepoint mapping, indexed by a two level page table. Covers
+// BMP and the planes of CJK extensions.
+class CodepointTable {
+public:
+    static constexpr uint32_t MaxCodepoint = 0x40000;
+
+    CodepointTable();
 
-        size_t operator()(const std::string_view str) const {
-            constexpr std::hash<std::string_view> hasher{};
-            return hasher(str);
+    // Keep the first mapping if there are multiple ones.
+    void insert(uint32_t from, uint32_t to);
+    // Return 0 if there is no mapping.
+    uint32_t lookup(uint32_t code) const {
+        if (code >= MaxCodepoint) {
+            return 0;
         }
-    };
+        return pages_[directory_[code >> PageBits]][code & PageMask];
+    }
+
+    size_t size() const { return size_; }
+
+private:
+    static constexpr uint32_t PageBits = 8;
+    static constexpr uint32_t PageMask = (1 << PageBits) - 1;
+    using Page = std::array<uint32_t, 1 << PageBits>;
+
+    // Page 0 is always empty, shared by all unmapped ranges.
+    std::array<uint16_t, (MaxCodepoint >> PageBits)> directory_;
+    std::vector<Page> pages_;
+    size_t size_ = 0;
+};
 
+class NativeBackend : public ChttransBackend {
 public:
-    using MapType = std::unordered_map<std::string, std::string, string_hash,
-                                       std::equal_to<>>;
-    std::string convertSimpToTrad(const std::string &) override;
-    std::string convertTradToSimp(const std::string &) override;
+    static std::string convert(const CodepointTable &table,
+                               const std::string &str);
 
 protected:
     bool loadOnce(const ChttransConfig &) override;
+    std::string doSimpToTrad(const std::string &) override;
+    std::string doTradToSimp(const std::string &) override;
+
+    // Same as above, but matchPhrase is tried first on every non-ASCII
+    // character. It appends the converted text to result and returns the
+    // number of bytes it consumes, or 0 to convert a single character.
+    template <typename MatchPhrase>
+    static std::string convert(const CodepointTable &table,
+                               const std::string &str,
+                               MatchPhrase matchPhrase);
+
+    const CodepointTable &s2tTable() const { return s2tTable_; }
+    const CodepointTable &t2sTable() const { return t2sTable_; }
 
 private:
-    MapType s2tMap_;
-    MapType t2sMap_;
+    static void appendUTF8(std::string &str, uint32_t code);
+
+    CodepointTable s2tTable_;
+    CodepointTable t2sTable_;
 };
 
+template <typename MatchPhrase>
+std::string NativeBackend::convert(const CodepointTable &table,
+                                   const std::string &str,
+                                   MatchPhrase matchPhrase) {
+    std::string result;
+    // Conversion between simplified and traditional Chinese almost always
+    // keeps the length.
+    result.reserve(str.size());
+    const char *cur = str.data();
+    const char *end = cur + str.size();
+    while (cur != end) {
+        // Copy ASCII as a whole.
+        const char *asciiEnd = std::find_if(cur, end, [](char c) {
+            return static_cast<unsigned char>(c) >= 0x80;
+        });
+        result.append(cur, asciiEnd);
+        cur = asciiEnd;
+        if (cur == end) {
+            break;
+        }
+
+        if (size_t length =
+                matchPhrase(std::string_view(cur, end - cur), result)) {
+            cur += length;
+            continue;
+        }
+
+        uint32_t code;
+        const char *next = fcitx::utf8::getNextChar(cur, end, &code);
+        if (!fcitx::utf8::isValidChar(code) || next == cur) {
+            return str;
+        }
+        if (auto mapped = table.lookup(code)) {
+            appendUTF8(result, mapped);
+        } else {
+            result.append(cur, next);
+        }
+        cur = next;
+    }
+    return result;
+}
+
 #endif // _CHTTRANS_CHTTRANS_NATIVE_H_
@@ -6,14 +6,53 @@
  */
 #include "chttrans-opencc.h"
 #include "chttrans.h"
+#include <chrono>
 #include <exception>
+#include <fcitx-utils/eventdispatcher.h>
+#include <fcitx-utils/log.h>
 #include <fcitx-utils/standardpaths.h>
 #include <fcitx-utils/stringutils.h>
+#include <future>
+#include <memory>
 #include <opencc.h>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace fcitx;
 
+namespace {
+
+// Convert all strings with a single call to converter. New line is never part
+// of a phrase, so it is used as the boundary between strings.
+std::vector<std::string>
+convertJoined(const opencc::SimpleConverter *converter,
+              const std::vector<std::string> &strs) {
+    if (!converter) {
+        return strs;
+    }
+    for (const auto &str : strs) {
+        if (str.find('\n') != std::string::npos) {
+            return {};
+        }
+    }
+    try {
+        auto result = stringutils::split(
+            converter->Convert(stringutils::join(strs, "\n")), "\n",
+            stringutils::SplitBehavior::KeepEmpty);
+        if (result.size() == strs.size()) {
+            return result;
+        }
+    } catch (const std::exception &e) {
+    }
+    return {};
+}
+
+} // namespace
+
+OpenCCBackend::OpenCCBackend(fcitx::EventDispatcher *dispatcher)
+    : dispatcher_(dispatcher) {}
+
 bool OpenCCBackend::loadOnce(const ChttransConfig &config) {
     updateConfig(config);
     return true;
@@ -36,15 +75,8 @@ void OpenCCBackend::updateConfig(const ChttransConfig &config) {
             s2tProfile = OPENCC_DEFAULT_CONFIG_SIMP_TO_TRAD;
         }
     }
-    auto s2tProfilePath = locateProfile(s2tProfile);
-    FCITX_DEBUG() << "s2tProfilePath: " << s2tProfilePath;
-
-    try {
-        auto s2t = std::make_unique<opencc::SimpleConverter>(s2tProfilePath);
-        s2t_ = std::move(s2t);
-    } catch (const std::exception &e) {
-        FCITX_WARN() << "exception when loading s2t profile: " << e.what();
-    }
+    s2t_.profilePath = locateProfile(s2tProfile);
+    FCITX_DEBUG() << "s2tProfilePath: " << s2t_.profilePath;
 
     auto t2sProfile = *config.openCCT2SProfile;
     if (t2sProfile.empty() || t2sProfile == "default") {
@@ -56,31 +88,104 @@ void OpenCCBackend::updateConfig(const ChttransConfig &config) {
             t2sProfile = OPENCC_DEFAULT_CONFIG_TRAD_TO_SIMP;
         }
     }
-    auto t2sProfilePath = locateProfile(t2sProfile);
-    FCITX_DEBUG() << "t2sProfilePath: " << t2sProfilePath;
+    t2s_.profilePath = locateProfile(t2sProfile);
+    FCITX_DEBUG() << "t2sProfilePath: " << t2s_.profilePath;
 
-    try {
-        auto t2s = std::make_unique<opencc::SimpleConverter>(t2sProfilePath);
-        t2s_ = std::move(t2s);
-    } catch (const std::exception &e) {
-        FCITX_WARN() << "exception when loading t2s profile: " << e.what();
+    // Only reload the converter that is already in use, the other one will be
+    // loaded on demand.
+    for (auto *converter : {&s2t_, &t2s_}) {
+        if (converter->used) {
+            startLoading(*converter);
+        }
     }
 }
 
-std::string OpenCCBackend::convertSimpToTrad(const std::string &str) {
-    if (s2t_) {
+bool OpenCCBackend::prepare(ChttransIMType type) {
+    auto &converter = type == ChttransIMType::Trad ? s2t_ : t2s_;
+    converter.used = true;
+    startLoading(converter);
+    // Pick up the result early if it is already there, never block.
+    if (converter.loading.valid() &&
+        converter.loading.wait_for(std::chrono::seconds(0)) ==
+            std::future_status::ready) {
+        finishLoading(converter);
+    }
+    return converter.converter != nullptr;
+}
+
+void OpenCCBackend::startLoading(Converter &converter) {
+    if (converter.loading.valid() ||
+        converter.loadingPath == converter.profilePath) {
+        return;
+    }
+    converter.loadingPath = converter.profilePath;
+    converter.loading = std::async(
+        std::launch::async, [this, &converter, ref = watch(),
+                             path = converter.loadingPath]() -> ConverterPtr {
+            ConverterPtr result;
+            try {
+                result = std::make_shared<opencc::SimpleConverter>(path);
+            } catch (const std::exception &e) {
+                FCITX_WARN() << "exception when loading profile " << path
+                             << ": " << e.what();
+            }
+            // Swap the converter on main thread, unless a newer profile is
+            // being loaded, which will schedule its own.
+            dispatcher_->scheduleWithContext(ref, [this, &converter, path]() {
+                if (converter.loadingPath == path) {
+                    finishLoading(converter);
+                }
+            });
+            return result;
+        });
+}
+
+void OpenCCBackend::finishLoading(Converter &converter) {
+    // Already finished by prepare().
+    if (!converter.loading.valid()) {
+        return;
+    }
+    // Keep the old converter if the new profile fails to load.
+    if (auto result = converter.loading.get()) {
+        converter.converter = std::move(result);
+        // Cached results may come from the old converter.
+        clearCache();
+    }
+    startLoading(converter);
+}
+
+std::string OpenCCBackend::doSimpToTrad(const std::string &str) {
+    if (s2t_.converter) {
         try {
-            return s2t_->Convert(str);
+            return s2t_.converter->Convert(str);
         } catch (const std::exception &e) {
         }
     }
     return str;
 }
 
-std::string OpenCCBackend::convertTradToSimp(const std::string &str) {
-    if (t2s_) {
+std::vector<std::string>
+OpenCCBackend::doSimpToTradBatch(const std::vector<std::string> &strs) {
+    auto result = convertJoined(s2t_.converter.get(), strs);
+    if (result.empty()) {
+        return ChttransBackend::doSimpToTradBatch(strs);
+    }
+    return result;
+}
+
+std::vector<std::string>
+OpenCCBackend::doTradToSimpBatch(const std::vector<std::string> &strs) {
+    auto result = convertJoined(t2s_.converter.get(), strs);
+    if (result.empty()) {
+        return ChttransBackend::doTradToSimpBatch(strs);
+    }
+    return result;
+}
+
+std::string OpenCCBackend::doTradToSimp(const std::string &str) {
+    if (t2s_.converter) {
         try {
-            return t2s_->Convert(str);
+            return t2s_.converter->Convert(str);
         } catch (const std::exception &e) {
         }
     }
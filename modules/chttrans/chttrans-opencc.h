@@ -8,23 +8,56 @@
 #define _CHTTRANS_CHTTRANS_OPENCC_H_
 
 #include "chttrans.h"
+#include <fcitx-utils/eventdispatcher.h>
+#include <fcitx-utils/trackableobject.h>
+#include <future>
+#include <memory>
 #include <opencc.h>
+#include <string>
+#include <vector>
 
-class OpenCCBackend : public ChttransBackend {
+// OpenCC profile can take hundreds of milliseconds to load, so it is loaded
+// in a background thread when it is first used or changed. Until the new
+// converter is ready, the old one keeps serving the requests.
+class OpenCCBackend : public ChttransBackend,
+                      public fcitx::TrackableObject<OpenCCBackend> {
 public:
-    std::string convertSimpToTrad(const std::string &) override;
-    std::string convertTradToSimp(const std::string &) override;
+    explicit OpenCCBackend(fcitx::EventDispatcher *dispatcher);
 
     void updateConfig(const ChttransConfig &config) override;
+    bool prepare(ChttransIMType type) override;
 
     std::string locateProfile(const std::string &);
 
 protected:
     bool loadOnce(const ChttransConfig &config) override;
+    std::string doSimpToTrad(const std::string &) override;
+    std::string doTradToSimp(const std::string &) override;
+    std::vector<std::string>
+    doSimpToTradBatch(const std::vector<std::string> &strs) override;
+    std::vector<std::string>
+    doTradToSimpBatch(const std::vector<std::string> &strs) override;
 
 private:
-    std::unique_ptr<opencc::SimpleConverter> s2t_;
-    std::unique_ptr<opencc::SimpleConverter> t2s_;
+    using ConverterPtr = std::shared_ptr<const opencc::SimpleConverter>;
+
+    struct Converter {
+        // Path of the configured profile.
+        std::string profilePath;
+        // Path of the profile that converter is loaded from, or being loaded.
+        std::string loadingPath;
+        ConverterPtr converter;
+        std::future<ConverterPtr> loading;
+        // Direction that is never used is not loaded at all.
+        bool used = false;
+    };
+
+    void startLoading(Converter &converter);
+    void finishLoading(Converter &converter);
+
+    fcitx::EventDispatcher *dispatcher_;
+    Converter s2t_;
+    Converter t2s_;
 };
 
 #endif // _CHTTRANS_CHTTRANS_OPENCC_H_
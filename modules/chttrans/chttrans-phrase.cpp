@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#include "chttrans-phrase.h"
+#include "chttrans-native.h"
+#include "chttrans.h"
+#include "phrasedict.h"
+#include <fcitx-utils/log.h>
+#include <fcitx-utils/standardpaths.h>
+#include <string>
+#include <string_view>
+
+#define PHRASE_S2T "chttrans/s2t.phrase"
+#define PHRASE_T2S "chttrans/t2s.phrase"
+
+using namespace fcitx;
+
+namespace {
+
+void loadDict(PhraseDict &dict, const char *name) {
+    auto path =
+        StandardPaths::global().locate(StandardPathsType::PkgData, name);
+    if (path.empty() || !dict.loadImage(path.string())) {
+        FCITX_WARN() << "Failed to load " << name
+                     << ", only characters will be converted.";
+    }
+}
+
+} // namespace
+
+bool PhraseBackend::loadOnce(const ChttransConfig &config) {
+    if (!NativeBackend::loadOnce(config)) {
+        return false;
+    }
+    loadDict(s2tDict_, PHRASE_S2T);
+    loadDict(t2sDict_, PHRASE_T2S);
+    return true;
+}
+
+std::string PhraseBackend::convert(const PhraseDict &dict,
+                                   const CodepointTable &table,
+                                   const std::string &str) {
+    if (dict.empty()) {
+        return NativeBackend::convert(table, str);
+    }
+    return NativeBackend::convert(
+        table, str, [&dict](std::string_view text, std::string &result) {
+            std::string_view value;
+            auto length = dict.match(text, &value);
+            result.append(value);
+            return length;
+        });
+}
+
+std::string PhraseBackend::doSimpToTrad(const std::string &str) {
+    return convert(s2tDict_, s2tTable(), str);
+}
+
+std::string PhraseBackend::doTradToSimp(const std::string &str) {
+    return convert(t2sDict_, t2sTable(), str);
+}
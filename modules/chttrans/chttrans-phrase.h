@@ -0,0 +1,33 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#ifndef _CHTTRANS_CHTTRANS_PHRASE_H_
+#define _CHTTRANS_CHTTRANS_PHRASE_H_
+
+#include "chttrans-native.h"
+#include "chttrans.h"
+#include "phrasedict.h"
+#include <string>
+
+// Forward maximum matching over phrase dictionaries, characters that are not
+// covered by any phrase are converted by the native table.
+class PhraseBackend : public NativeBackend {
+public:
+    static std::string convert(const PhraseDict &dict,
+                               const CodepointTable &table,
+                               const std::string &str);
+
+protected:
+    bool loadOnce(const ChttransConfig &config) override;
+    std::string doSimpToTrad(const std::string &) override;
+    std::string doTradToSimp(const std::string &) override;
+
+private:
+    PhraseDict s2tDict_;
+    PhraseDict t2sDict_;
+};
+
+#endif // _CHTTRANS_CHTTRANS_PHRASE_H_
@@ -7,6 +7,7 @@
 
 #include "chttrans.h"
 #include "chttrans-native.h"
+#include "chttrans-phrase.h"
 #include "config.h"
 #include "notifications_public.h"
 #include <algorithm>
@@ -22,9 +23,11 @@
 #include <fcitx/addonfactory.h>
 #include <fcitx/addoninstance.h>
 #include <fcitx/addonmanager.h>
+#include <fcitx/candidatelist.h>
 #include <fcitx/event.h>
 #include <fcitx/inputcontext.h>
 #include <fcitx/inputmethodentry.h>
+#include <fcitx/inputpanel.h>
 #include <fcitx/instance.h>
 #include <fcitx/text.h>
 #include <fcitx/userinterface.h>
@@ -84,10 +87,15 @@ Chttrans::Chttrans(fcitx::Instance *instance) : instance_(instance) {
                                                      &toggleAction_);
 #ifdef ENABLE_OPENCC
     backends_.emplace(ChttransEngine::OpenCC,
-                      std::make_unique<OpenCCBackend>());
+                      std::make_unique<OpenCCBackend>(
+                          &instance_->eventDispatcher()));
 #endif
     backends_.emplace(ChttransEngine::Native,
                       std::make_unique<NativeBackend>());
+#ifdef ENABLE_CHTTRANS_PHRASE
+    backends_.emplace(ChttransEngine::Phrase,
+                      std::make_unique<PhraseBackend>());
+#endif
     reloadConfig();
 
     eventHandler_ = instance_->watchEvent(
@@ -221,15 +229,13 @@ void Chttrans::populateConfig() {
     enabledIM_.insert(config_.enabledIM.value().begin(),
                       config_.enabledIM.value().end());
     for (const auto &backend : backends_) {
+        // Profile may be changed.
+        backend.second->clearCache();
         if (backend.second->loaded()) {
             backend.second->updateConfig(config_);
         }
     }
-#ifdef ENABLE_OPENCC
     auto engine = config_.engine.value();
-#else
-    auto engine = ChttransEngine::Native;
-#endif
 
     auto iter = backends_.find(engine);
     if (iter == backends_.end() && engine != ChttransEngine::Native) {
@@ -290,15 +296,132 @@ const Configuration *Chttrans::getConfig() const {
     return &config_;
 }
 
-std::string Chttrans::convert(ChttransIMType type, const std::string &str) {
+std::vector<std::string>
+ChttransBackend::doSimpToTradBatch(const std::vector<std::string> &strs) {
+    std::vector<std::string> result;
+    result.reserve(strs.size());
+    for (const auto &str : strs) {
+        result.push_back(doSimpToTrad(str));
+    }
+    return result;
+}
+
+std::vector<std::string>
+ChttransBackend::doTradToSimpBatch(const std::vector<std::string> &strs) {
+    std::vector<std::string> result;
+    result.reserve(strs.size());
+    for (const auto &str : strs) {
+        result.push_back(doTradToSimp(str));
+    }
+    return result;
+}
+
+void ChttransBackend::cachedConvertBatch(Cache &cache,
+                                         std::vector<std::string> &strs,
+                                         BatchConverter convert) {
+    std::vector<size_t> missIndex;
+    std::vector<std::string> miss;
+    for (size_t i = 0; i < strs.size(); i++) {
+        if (strs[i].size() <= MaxCachedLength) {
+            if (const auto *result = cache.find(strs[i])) {
+                cacheStats_.hit += 1;
+                strs[i] = *result;
+                continue;
+            }
+            cacheStats_.miss += 1;
+        }
+        missIndex.push_back(i);
+        miss.push_back(strs[i]);
+    }
+    if (miss.empty()) {
+        return;
+    }
+    auto results = (this->*convert)(miss);
+    if (results.size() != miss.size()) {
+        return;
+    }
+    for (size_t i = 0; i < missIndex.size(); i++) {
+        if (miss[i].size() <= MaxCachedLength) {
+            cache.insert(miss[i], results[i]);
+        }
+        strs[missIndex[i]] = std::move(results[i]);
+    }
+}
+
+ChttransBackend *Chttrans::backend(ChttransIMType type) {
     if (!currentBackend_ || !currentBackend_->load(config_)) {
+        return nullptr;
+    }
+    if (currentBackend_->prepare(type)) {
+        return currentBackend_;
+    }
+    auto iter = backends_.find(ChttransEngine::Native);
+    if (iter == backends_.end() || !iter->second->load(config_)) {
+        return nullptr;
+    }
+    return iter->second.get();
+}
+
+std::string Chttrans::convert(ChttransIMType type, const std::string &str) {
+    auto *backend = this->backend(type);
+    if (!backend) {
         return str;
     }
 
     if (type == ChttransIMType::Trad) {
-        return currentBackend_->convertSimpToTrad(str);
+        return backend->convertSimpToTrad(str);
+    }
+    return backend->convertTradToSimp(str);
+}
+
+bool Chttrans::convertBatch(InputContext *inputContext,
+                            std::vector<std::string> &strs) {
+    if (!toggleAction_.isParent(&inputContext->statusArea())) {
+        return false;
+    }
+    auto type = convertType(inputContext);
+    if (type == ChttransIMType::Other) {
+        return false;
+    }
+    auto *backend = this->backend(type);
+    if (!backend) {
+        return false;
+    }
+    // Same as output filter, leave invalid string untouched.
+    std::vector<size_t> validIndex;
+    std::vector<std::string> valid;
+    for (size_t i = 0; i < strs.size(); i++) {
+        if (!strs[i].empty() &&
+            utf8::lengthValidated(strs[i]) != utf8::INVALID_LENGTH) {
+            validIndex.push_back(i);
+            valid.push_back(std::move(strs[i]));
+        }
+    }
+    if (type == ChttransIMType::Trad) {
+        backend->convertSimpToTrad(valid);
+    } else {
+        backend->convertTradToSimp(valid);
+    }
+    for (size_t i = 0; i < validIndex.size(); i++) {
+        strs[validIndex[i]] = std::move(valid[i]);
+    }
+    return true;
+}
+
+void Chttrans::convertCandidateList(InputContext *inputContext) {
+    auto candidateList = inputContext->inputPanel().candidateList();
+    if (!candidateList || candidateList->empty()) {
+        return;
+    }
+    std::vector<std::string> strs;
+    for (int i = 0; i < candidateList->size(); i++) {
+        const auto &candidate = candidateList->candidate(i);
+        strs.push_back(candidate.text().toString());
+        if (!candidate.comment().empty()) {
+            strs.push_back(candidate.comment().toString());
+        }
     }
-    return currentBackend_->convertTradToSimp(str);
+    convertBatch(inputContext, strs);
 }
 
 ChttransIMType
@@ -7,8 +7,12 @@
 #ifndef _CHTTRANS_CHTTRANS_H_
 #define _CHTTRANS_CHTTRANS_H_
 
+#include "../../common/flatcache.h"
+#include "chttrans_public.h"
 #include "config.h"
 #include "notifications_public.h"
+#include <cstddef>
+#include <cstdint>
 #include <fcitx-config/configuration.h>
 #include <fcitx-config/enum.h>
 #include <fcitx-config/iniparser.h>
@@ -18,7 +22,9 @@
 #include <fcitx/addoninstance.h>
 #include <fcitx/addonmanager.h>
 #include <fcitx/instance.h>
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 #ifdef ENABLE_OPENCC
 struct OpenCCAnnotation : public fcitx::EnumAnnotation {
@@ -41,14 +47,22 @@ private:
 };
 #endif
 
+// Phrase is only offered when its dictionaries are built.
+#ifdef ENABLE_CHTTRANS_PHRASE
+FCITX_CONFIG_ENUM(ChttransEngine, Native, OpenCC, Phrase);
+#else
 FCITX_CONFIG_ENUM(ChttransEngine, Native, OpenCC);
+#endif
 
 FCITX_CONFIGURATION(
     ChttransConfig,
-#ifdef ENABLE_OPENCC
     fcitx::Option<ChttransEngine> engine{this, "Engine", _("Translate engine"),
-                                         ChttransEngine::OpenCC};
+#ifdef ENABLE_OPENCC
+                                         ChttransEngine::OpenCC
+#else
+                                         ChttransEngine::Native
 #endif
+    };
     fcitx::Option<fcitx::KeyList> hotkey{
         this, "Hotkey", _("Toggle key"), {fcitx::Key("Control+Shift+F")}};
     fcitx::HiddenOption<std::vector<std::string>> enabledIM{
@@ -69,6 +83,11 @@ FCITX_CONFIGURATION(
 
 enum class ChttransIMType { Simp, Trad, Other };
 
+struct ChttransCacheStats {
+    uint64_t hit = 0;
+    uint64_t miss = 0;
+};
+
 class ChttransBackend {
 public:
     virtual ~ChttransBackend() {}
@@ -79,18 +98,78 @@ public:
         }
         return loadResult_;
     }
-    virtual std::string convertSimpToTrad(const std::string &) = 0;
-    virtual std::string convertTradToSimp(const std::string &) = 0;
+    // The same candidates and preedit are converted again on every refresh of
+    // input panel, so the result of short strings are memoized.
+    std::string convertSimpToTrad(const std::string &str) {
+        return cachedConvert(s2tCache_, str, &ChttransBackend::doSimpToTrad);
+    }
+    std::string convertTradToSimp(const std::string &str) {
+        return cachedConvert(t2sCache_, str, &ChttransBackend::doTradToSimp);
+    }
+    // Convert in place, the ones that are not cached are converted together.
+    void convertSimpToTrad(std::vector<std::string> &strs) {
+        cachedConvertBatch(s2tCache_, strs,
+                           &ChttransBackend::doSimpToTradBatch);
+    }
+    void convertTradToSimp(std::vector<std::string> &strs) {
+        cachedConvertBatch(t2sCache_, strs,
+                           &ChttransBackend::doTradToSimpBatch);
+    }
     bool loaded() { return loaded_ && loadResult_; }
 
     virtual void updateConfig(const ChttransConfig &) {}
+    // Return false if backend can not convert for type yet, e.g. it is still
+    // loading in the background.
+    virtual bool prepare(ChttransIMType /*type*/) { return true; }
+
+    void clearCache() {
+        s2tCache_.clear();
+        t2sCache_.clear();
+    }
+    const ChttransCacheStats &cacheStats() const { return cacheStats_; }
 
 protected:
     virtual bool loadOnce(const ChttransConfig &) = 0;
+    virtual std::string doSimpToTrad(const std::string &) = 0;
+    virtual std::string doTradToSimp(const std::string &) = 0;
+    // Backend may override these if converting multiple strings together is
+    // cheaper than converting them one by one.
+    virtual std::vector<std::string>
+    doSimpToTradBatch(const std::vector<std::string> &strs);
+    virtual std::vector<std::string>
+    doTradToSimpBatch(const std::vector<std::string> &strs);
 
 private:
+    static constexpr size_t CacheSize = 1024;
+    // Longer string is usually a commit string, which is unlikely to repeat.
+    static constexpr size_t MaxCachedLength = 256;
+    using Cache = fcitx::FlatCache<std::string, std::string>;
+    using Converter = std::string (ChttransBackend::*)(const std::string &);
+    using BatchConverter = std::vector<std::string> (ChttransBackend::*)(
+        const std::vector<std::string> &);
+
+    std::string cachedConvert(Cache &cache, const std::string &str,
+                              Converter convert) {
+        if (str.size() > MaxCachedLength) {
+            return (this->*convert)(str);
+        }
+        if (const auto *result = cache.find(str)) {
+            cacheStats_.hit += 1;
+            return *result;
+        }
+        cacheStats_.miss += 1;
+        auto result = (this->*convert)(str);
+        cache.insert(str, result);
+        return result;
+    }
+    void cachedConvertBatch(Cache &cache, std::vector<std::string> &strs,
+                            BatchConverter convert);
+
     bool loaded_ = false;
     bool loadResult_ = false;
+    Cache s2tCache_{CacheSize};
+    Cache t2sCache_{CacheSize};
+    ChttransCacheStats cacheStats_;
 };
 
 class Chttrans final : public fcitx::AddonInstance {
@@ -139,12 +218,21 @@ public:
     // The actual language consider both input method & conversion.
     ChttransIMType currentType(fcitx::InputContext *inputContext) const;
     std::string convert(ChttransIMType type, const std::string &str);
+    bool convertBatch(fcitx::InputContext *inputContext,
+                      std::vector<std::string> &strs);
+    void convertCandidateList(fcitx::InputContext *inputContext);
     void toggle(fcitx::InputContext *ic);
 
     FCITX_ADDON_DEPENDENCY_LOADER(notifications, instance_->addonManager());
 
 private:
+    FCITX_ADDON_EXPORT_FUNCTION(Chttrans, convertBatch);
+    FCITX_ADDON_EXPORT_FUNCTION(Chttrans, convertCandidateList);
+
     void syncToConfig();
+    // Return current backend if it is ready for type, otherwise fallback to
+    // the native one.
+    ChttransBackend *backend(ChttransIMType type);
 
     fcitx::Instance *instance_;
     ChttransConfig config_;
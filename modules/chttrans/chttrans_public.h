@@ -0,0 +1,25 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#ifndef _CHTTRANS_CHTTRANS_PUBLIC_H_
+#define _CHTTRANS_CHTTRANS_PUBLIC_H_
+
+#include <fcitx/addoninstance.h>
+#include <fcitx/inputcontext.h>
+#include <string>
+#include <vector>
+
+// Convert strings in place with the conversion of the input context, in a
+// single pass. Return false if no conversion is enabled for the input context.
+FCITX_ADDON_DECLARE_FUNCTION(Chttrans, convertBatch,
+                             bool(fcitx::InputContext *,
+                                  std::vector<std::string> &));
+// Convert the current page of candidate list ahead of displaying it, so that
+// the result can be reused when the input panel is rendered.
+FCITX_ADDON_DECLARE_FUNCTION(Chttrans, convertCandidateList,
+                             void(fcitx::InputContext *));
+
+#endif // _CHTTRANS_CHTTRANS_PUBLIC_H_
@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+
+// Compile OpenCC style text dictionaries into the image used by the phrase
+// based chttrans backend. When a phrase appears in multiple inputs, the first
+// one wins, so phrase dictionary should go before character dictionary.
+//
+// Usage: genchttransphrase <output> <input>...
+
+#include "phrasedict.h"
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <output> <input>..."
+                  << std::endl;
+        return 1;
+    }
+    PhraseDict dict;
+    for (int i = 2; i < argc; i++) {
+        std::ifstream in(argv[i]);
+        if (!in) {
+            std::cerr << "Failed to open " << argv[i] << std::endl;
+            return 1;
+        }
+        dict.loadText(in);
+    }
+    if (dict.empty()) {
+        std::cerr << "No phrase found." << std::endl;
+        return 1;
+    }
+    std::ofstream out(argv[1], std::ios::out | std::ios::binary |
+                                   std::ios::trunc);
+    if (!out || !dict.save(out)) {
+        std::cerr << "Failed to write " << argv[1] << std::endl;
+        return 1;
+    }
+    return 0;
+}
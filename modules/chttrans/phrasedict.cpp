@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#include "phrasedict.h"
+#include "../../common/mappedfile.h"
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fcitx-utils/utf8.h>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace fcitx;
+
+namespace {
+
+constexpr std::string_view Magic = "CTPD";
+constexpr uint32_t Version = 2;
+constexpr size_t HeaderSize = Magic.size() + sizeof(uint32_t) * 4;
+
+uint32_t readUInt32(const char *data) {
+    const auto *bytes = reinterpret_cast<const unsigned char *>(data);
+    return static_cast<uint32_t>(bytes[0]) |
+           (static_cast<uint32_t>(bytes[1]) << 8) |
+           (static_cast<uint32_t>(bytes[2]) << 16) |
+           (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+void writeUInt32(std::ostream &out, uint32_t value) {
+    const char bytes[] = {static_cast<char>(value & 0xff),
+                          static_cast<char>((value >> 8) & 0xff),
+                          static_cast<char>((value >> 16) & 0xff),
+                          static_cast<char>((value >> 24) & 0xff)};
+    out.write(bytes, sizeof(bytes));
+}
+
+} // namespace
+
+void PhraseDict::loadText(std::istream &in) {
+    // Keep the offsets of existing values valid.
+    if (file_.isValid()) {
+        buffer_.assign(values_);
+        file_.reset();
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        std::string_view view(line);
+        if (!view.empty() && view.back() == '\r') {
+            view.remove_suffix(1);
+        }
+        auto tab = view.find('\t');
+        if (tab == 0 || tab == std::string_view::npos) {
+            continue;
+        }
+        auto key = view.substr(0, tab);
+        // Only the first alternative is used.
+        auto value = view.substr(tab + 1);
+        value = value.substr(0, value.find(' '));
+        if (value.empty() || value.find('\0') != std::string_view::npos ||
+            buffer_.size() >= std::numeric_limits<int32_t>::max() ||
+            trie_.hasExactMatch(key)) {
+            continue;
+        }
+        trie_.set(key, static_cast<int32_t>(buffer_.size()));
+        buffer_.append(value);
+        buffer_.push_back('\0');
+        size_ += 1;
+    }
+    values_ = buffer_;
+}
+
+bool PhraseDict::save(std::ostream &out) {
+    std::ostringstream trie;
+    try {
+        trie_.save(trie);
+    } catch (const std::exception &) {
+        return false;
+    }
+    const auto trieData = trie.str();
+    out.write(Magic.data(), Magic.size());
+    writeUInt32(out, Version);
+    writeUInt32(out, size_);
+    writeUInt32(out, trieData.size());
+    writeUInt32(out, values_.size());
+    out.write(trieData.data(), trieData.size());
+    out.write(values_.data(), values_.size());
+    return out.good();
+}
+
+bool PhraseDict::loadImage(const std::string &path) {
+    MappedFile file(path);
+    if (!file.isValid()) {
+        return false;
+    }
+    const auto data = file.view();
+    if (data.size() < HeaderSize || !data.starts_with(Magic)) {
+        return false;
+    }
+    const auto version = readUInt32(data.data() + Magic.size());
+    const size_t count = readUInt32(data.data() + Magic.size() + 4);
+    const size_t trieSize = readUInt32(data.data() + Magic.size() + 8);
+    const size_t valueSize = readUInt32(data.data() + Magic.size() + 12);
+    if (version != Version ||
+        HeaderSize + trieSize + valueSize != data.size() ||
+        (valueSize != 0 && data.back() != '\0')) {
+        return false;
+    }
+
+    TrieType trie;
+    try {
+        MappedFileStreamBuf buffer(data.substr(HeaderSize, trieSize));
+        std::istream in(&buffer);
+        trie.load(in);
+    } catch (const std::exception &) {
+        return false;
+    }
+
+    trie_ = std::move(trie);
+    buffer_.clear();
+    file_ = std::move(file);
+    values_ = file_.view().substr(HeaderSize + trieSize);
+    size_ = count;
+    return true;
+}
+
+size_t PhraseDict::match(std::string_view text,
+                         std::string_view *value) const {
+    TrieType::position_type pos = 0;
+    size_t matched = 0;
+    int32_t offset = 0;
+    const char *cur = text.data();
+    const char *end = cur + text.size();
+    while (cur != end) {
+        // Phrase may only end at character boundary.
+        uint32_t code;
+        const char *next = utf8::getNextChar(cur, end, &code);
+        if (!utf8::isValidChar(code) || next == cur) {
+            break;
+        }
+        auto result = trie_.traverse(cur, next - cur, pos);
+        if (TrieType::isNoPath(result)) {
+            break;
+        }
+        cur = next;
+        if (TrieType::isValid(result)) {
+            matched = cur - text.data();
+            offset = result;
+        }
+    }
+    if (matched == 0 || offset < 0 ||
+        static_cast<size_t>(offset) >= values_.size()) {
+        return 0;
+    }
+    if (value) {
+        // Value is always NUL terminated, checked by loadImage.
+        *value = std::string_view(values_.data() + offset);
+    }
+    return matched;
+}
@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#ifndef _CHTTRANS_PHRASEDICT_H_
+#define _CHTTRANS_PHRASEDICT_H_
+
+#include "../../common/mappedfile.h"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <libime/core/datrie.h>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+// Phrase to phrase mapping used by the phrase based chttrans backend.
+//
+// The dictionary is compiled from OpenCC style text dictionary, one
+// "phrase\tconverted [alternatives...]" per line, into a binary image:
+//
+//   "CTPD" | version | count | trie size | value size | trie | values
+//
+// Integers are 32bit little endian. The trie maps each phrase to the offset of
+// its NUL terminated value. The image is memory mapped, so the values are
+// shared by all the processes using it.
+class PhraseDict {
+public:
+    // Add the entries from text dictionary, existing phrase is not replaced.
+    void loadText(std::istream &in);
+    bool save(std::ostream &out);
+    bool loadImage(const std::string &path);
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    // Return the byte length of the longest phrase that text starts with, or 0
+    // if there is none. value is set to the converted phrase.
+    size_t match(std::string_view text, std::string_view *value) const;
+
+private:
+    using TrieType = libime::DATrie<int32_t>;
+
+    TrieType trie_;
+    // Values appended by loadText.
+    std::string buffer_;
+    fcitx::MappedFile file_;
+    // Points to either buffer_ or file_.
+    std::string_view values_;
+    size_t size_ = 0;
+};
+
+#endif // _CHTTRANS_PHRASEDICT_H_
@@ -0,0 +1,29 @@
+#!/bin/bash
+
+# Compile gbks2t.tab into gbks2t.h, so the native backend does not need to
+# parse it at runtime. Run it again after gbks2t.tab is changed.
+
+export LC_ALL=C.UTF-8
+
+cat > gbks2t.h <<HEADER
+// Generated from gbks2t.tab by update-gbks2t.sh, do not edit.
+#include <cstdint>
+
+namespace {
+
+// Pairs of simplified and traditional codepoint, in file order.
+constexpr uint32_t GBKS2TTable[][2] = {
+HEADER
+
+while IFS= read -r line; do
+    if [[ ${#line} -lt 2 ]]; then
+        continue
+    fi
+    printf "    {0x%x, 0x%x},\n" "'${line:0:1}" "'${line:1:1}" >> gbks2t.h
+done < gbks2t.tab
+
+cat >> gbks2t.h <<HEADER
+};
+
+} // namespace
+HEADER
@@ -28,6 +28,7 @@
 #include <string_view>
 #include <unistd.h>
 #include <utility>
+#include <vector>
 
 using namespace fcitx;
 
@@ -107,6 +108,7 @@ public:
 
 constexpr int MAX_ERROR = 10;
 constexpr uint64_t minInUs = 60000000;
+constexpr int64_t secondsInDay = 86400;
 
 } // namespace
 
@@ -144,16 +146,68 @@ CloudPinyin::~CloudPinyin() {}
 
 void CloudPinyin::reloadConfig() {
     readAsIni(config_, "conf/cloudpinyin.conf");
+    populateConfig();
+}
+
+void CloudPinyin::populateConfig() {
+    for (auto &[_, diskCache] : diskCaches_) {
+        diskCache->setLimit(*config_.persistentCacheSize,
+                            *config_.persistentCacheDays * secondsInDay);
+    }
+    // Start reading the cache of current backend before the first lookup.
+    diskCache();
+}
+
+FlatCache<std::string, std::string> &CloudPinyin::cache() {
+    // Results are different between backends, do not mix them.
+    if (cacheBackend_ != *config_.backend) {
+        cache_.clear();
+        cacheBackend_ = *config_.backend;
+    }
+    return cache_;
+}
+
+CloudPinyinDiskCache *CloudPinyin::diskCache() {
+    if (!*config_.persistentCache) {
+        return nullptr;
+    }
+    auto backend = *config_.backend;
+    auto iter = diskCaches_.find(backend);
+    if (iter == diskCaches_.end()) {
+        iter = diskCaches_
+                   .emplace(backend,
+                            std::make_unique<CloudPinyinDiskCache>(
+                                CloudPinyinBackendToString(backend),
+                                *config_.persistentCacheSize,
+                                *config_.persistentCacheDays * secondsInDay))
+                   .first;
+        // File is read in background, lookups miss until it is ready.
+        iter->second->loadAsync();
+    }
+    return iter->second.get();
 }
 
 void CloudPinyin::request(const std::string &pinyin,
                           CloudPinyinCallback callback) {
+    requestFor(nullptr, pinyin, std::move(callback));
+}
+
+void CloudPinyin::requestFor(InputContext *inputContext,
+                             const std::string &pinyin,
+                             CloudPinyinCallback callback) {
     if (static_cast<int>(pinyin.size()) < config_.minimumLength.value()) {
         callback(pinyin, "");
         return;
     }
-    if (auto *value = cache_.find(pinyin)) {
+    auto *disk = diskCache();
+    if (auto *value = cache().find(pinyin)) {
         callback(pinyin, *value);
+    } else if (const auto *value = disk ? disk->find(pinyin) : nullptr) {
+        cache().insert(pinyin, *value);
+        callback(pinyin, *value);
+    } else if (auto iter = pending_.find(pinyin); iter != pending_.end()) {
+        // Same pinyin is being fetched, share the result.
+        iter->second.callbacks.emplace_back(inputContext, std::move(callback));
     } else {
         auto backend = config_.backend.value();
         auto iter = backends_.find(backend);
@@ -162,8 +216,9 @@ void CloudPinyin::request(const std::string &pinyin,
             return;
         }
         auto *b = iter->second.get();
+        CurlQueue *queued = nullptr;
         if (!thread_->addRequest([proxy = *config_.proxy, b, &pinyin,
-                                  &callback](CurlQueue *queue) {
+                                  &queued](CurlQueue *queue) {
                 if (!b->prepareRequest(queue, pinyin)) {
                     return false;
                 }
@@ -174,14 +229,87 @@ void CloudPinyin::request(const std::string &pinyin,
                 }
                 queue->setPinyin(pinyin);
                 queue->setBusy();
-                queue->setCallback(callback);
+                queued = queue;
                 return true;
             })) {
             callback(pinyin, "");
+            return;
         }
+        auto &pending = pending_[pinyin];
+        pending.queue = queued;
+        pending.serial = queued->serial();
+        pending.callbacks.emplace_back(inputContext, std::move(callback));
     }
 }
 
+void CloudPinyin::cancel(InputContext *inputContext,
+                         const std::string &input) {
+    std::vector<std::pair<CurlQueue *, uint64_t>> stale;
+    for (auto iter = pending_.begin(); iter != pending_.end();) {
+        if (input.starts_with(iter->first)) {
+            ++iter;
+            continue;
+        }
+        auto &callbacks = iter->second.callbacks;
+        std::erase_if(callbacks, [inputContext](const auto &callback) {
+            return callback.first == inputContext;
+        });
+        // Someone else is still waiting for it.
+        if (!callbacks.empty()) {
+            ++iter;
+            continue;
+        }
+        stale.emplace_back(iter->second.queue, iter->second.serial);
+        iter = pending_.erase(iter);
+    }
+    if (!stale.empty()) {
+        thread_->cancelRequests(std::move(stale));
+    }
+}
+
+bool CloudPinyin::prefetch(InputContext *inputContext,
+                           const std::string &pinyin,
+                           CloudPinyinCallback callback) {
+    if (!*config_.prefetch || errorCount_ >= MAX_ERROR ||
+        static_cast<int>(pinyin.size()) < *config_.minimumLength) {
+        return false;
+    }
+    if (cache().find(pinyin)) {
+        return false;
+    }
+    if (auto *disk = diskCache(); disk && disk->find(pinyin)) {
+        return false;
+    }
+
+    // Only the latest input is fetched. The ones that are typed quickly are
+    // skipped. Results of shorter prefixes that are still in flight are kept in
+    // cache when they arrive.
+    prefetchInputContext_ = inputContext;
+    prefetchPinyin_ = pinyin;
+    prefetchCallback_ = std::move(callback);
+    const uint64_t time =
+        now(CLOCK_MONOTONIC) + static_cast<uint64_t>(*config_.prefetchDelay) *
+                                   1000;
+    if (!prefetchEvent_) {
+        prefetchEvent_ = eventLoop_->addTimeEvent(
+            CLOCK_MONOTONIC, time, 1000, [this](EventSourceTime *, uint64_t) {
+                auto *inputContext =
+                    std::exchange(prefetchInputContext_, nullptr);
+                auto pinyin = std::move(prefetchPinyin_);
+                auto callback = std::move(prefetchCallback_);
+                prefetchPinyin_.clear();
+                prefetchCallback_ = CloudPinyinCallback();
+                // Identical request that is in flight is shared.
+                requestFor(inputContext, pinyin, std::move(callback));
+                return true;
+            });
+    } else {
+        prefetchEvent_->setTime(time);
+    }
+    prefetchEvent_->setOneShot();
+    return true;
+}
+
 void CloudPinyin::notifyFinished() {
     dispatcher_.scheduleWithContext(this->watch(), [this]() {
         CurlQueue *item;
@@ -193,6 +321,24 @@ void CloudPinyin::notifyFinished() {
         }
 
         while ((item = thread_->popFinished())) {
+            auto pending = pending_.find(item->pinyin());
+            if (pending != pending_.end() &&
+                (pending->second.queue != item ||
+                 pending->second.serial != item->serial())) {
+                pending = pending_.end();
+            }
+            if (item->cancelled()) {
+                // Do not leave anyone waiting for the cancelled request.
+                if (pending != pending_.end()) {
+                    auto callbacks = std::move(pending->second.callbacks);
+                    pending_.erase(pending);
+                    for (const auto &[_, callback] : callbacks) {
+                        callback(item->pinyin(), "");
+                    }
+                }
+                item->release();
+                continue;
+            }
             if (item->httpCode() != 200) {
                 errorCount_ += 1;
 
@@ -210,9 +356,20 @@ void CloudPinyin::notifyFinished() {
             } else {
                 hanzi = "";
             }
-            item->callback()(item->pinyin(), hanzi);
             if (!hanzi.empty()) {
-                cache_.insert(item->pinyin(), hanzi);
+                cache().insert(item->pinyin(), hanzi);
+                if (auto *disk = diskCache()) {
+                    disk->insert(item->pinyin(), hanzi);
+                }
+            }
+            // The request may be cancelled after it is finished, and a new
+            // request of the same pinyin might be issued.
+            if (pending != pending_.end()) {
+                auto callbacks = std::move(pending->second.callbacks);
+                pending_.erase(pending);
+                for (const auto &[_, callback] : callbacks) {
+                    callback(item->pinyin(), hanzi);
+                }
             }
             item->release();
         }
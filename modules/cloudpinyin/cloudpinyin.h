@@ -7,9 +7,11 @@
 #ifndef _CLOUDPINYIN_CLOUDPINYIN_H_
 #define _CLOUDPINYIN_CLOUDPINYIN_H_
 
+#include "../../common/flatcache.h"
 #include "cloudpinyin_public.h"
+#include "diskcache.h"
 #include "fetch.h"
-#include "lrucache.h"
+#include <cstdint>
 #include <fcitx-config/configuration.h>
 #include <fcitx-config/enum.h>
 #include <fcitx-config/iniparser.h>
@@ -20,6 +22,10 @@
 #include <fcitx/addonfactory.h>
 #include <fcitx/addoninstance.h>
 #include <fcitx/instance.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 FCITX_CONFIG_ENUM(CloudPinyinBackend, Google, GoogleCN, Baidu);
 FCITX_CONFIGURATION(
@@ -42,7 +48,22 @@ FCITX_CONFIGURATION(
         {},
         {_("The proxy format must be the one that is supported by cURL. "
            "Usually it is in the format of [scheme]://[host]:[port], e.g. "
-           "http://localhost:1080.")}};);
+           "http://localhost:1080.")}};
+    fcitx::Option<bool> persistentCache{
+        this, "PersistentCache", _("Keep cloud pinyin results on disk"), false};
+    fcitx::Option<int, fcitx::IntConstrain> persistentCacheSize{
+        this, "PersistentCacheSize",
+        _("Maximum number of results kept on disk"), 10000,
+        fcitx::IntConstrain(0)};
+    fcitx::Option<int, fcitx::IntConstrain> persistentCacheDays{
+        this, "PersistentCacheDays",
+        _("Days to keep cloud pinyin results on disk"), 30,
+        fcitx::IntConstrain(1)};
+    fcitx::Option<bool> prefetch{this, "Prefetch",
+                                 _("Prefetch results while typing"), false};
+    fcitx::Option<int, fcitx::IntConstrain> prefetchDelay{
+        this, "PrefetchDelay", _("Prefetch delay (ms)"), 200,
+        fcitx::IntConstrain(0, 2000)};);
 
 class Backend {
 public:
@@ -63,9 +84,15 @@ public:
     void setConfig(const fcitx::RawConfig &config) override {
         config_.load(config, true);
         fcitx::safeSaveAsIni(config_, "conf/cloudpinyin.conf");
+        populateConfig();
     }
 
     void request(const std::string &pinyin, CloudPinyinCallback callback);
+    void requestFor(fcitx::InputContext *inputContext,
+                    const std::string &pinyin, CloudPinyinCallback callback);
+    void cancel(fcitx::InputContext *inputContext, const std::string &input);
+    bool prefetch(fcitx::InputContext *inputContext, const std::string &pinyin,
+                  CloudPinyinCallback callback);
     const fcitx::KeyList &toggleKey() const {
         return config_.toggleKey.value();
     }
@@ -77,7 +104,16 @@ public:
     void notifyFinished();
 
 private:
+    void populateConfig();
+    // Memory cache of current backend.
+    fcitx::FlatCache<std::string, std::string> &cache();
+    // Disk cache of current backend, may be null if disabled.
+    CloudPinyinDiskCache *diskCache();
+
     FCITX_ADDON_EXPORT_FUNCTION(CloudPinyin, request);
+    FCITX_ADDON_EXPORT_FUNCTION(CloudPinyin, requestFor);
+    FCITX_ADDON_EXPORT_FUNCTION(CloudPinyin, cancel);
+    FCITX_ADDON_EXPORT_FUNCTION(CloudPinyin, prefetch);
     FCITX_ADDON_EXPORT_FUNCTION(CloudPinyin, toggleKey);
     FCITX_ADDON_EXPORT_FUNCTION(CloudPinyin, resetError);
     std::unique_ptr<FetchThread> thread_;
@@ -85,10 +121,28 @@ private:
     fcitx::EventDispatcher &dispatcher_;
     std::unique_ptr<fcitx::EventSourceIO> event_;
     std::unique_ptr<fcitx::EventSourceTime> resetError_;
-    LRUCache<std::string, std::string> cache_{2048};
+    std::unique_ptr<fcitx::EventSourceTime> prefetchEvent_;
+    // Only used to identify the requester, never dereferenced.
+    fcitx::InputContext *prefetchInputContext_ = nullptr;
+    std::string prefetchPinyin_;
+    CloudPinyinCallback prefetchCallback_;
+    fcitx::FlatCache<std::string, std::string> cache_{2048};
+    CloudPinyinBackend cacheBackend_ = CloudPinyinBackend::GoogleCN;
     std::unordered_map<CloudPinyinBackend, std::unique_ptr<Backend>,
                        fcitx::EnumHash>
         backends_;
+    std::unordered_map<CloudPinyinBackend,
+                       std::unique_ptr<CloudPinyinDiskCache>, fcitx::EnumHash>
+        diskCaches_;
+    // In flight requests, identical requests share the same fetch.
+    struct PendingRequest {
+        CurlQueue *queue;
+        uint64_t serial;
+        // Requester of each callback, null if it can't be cancelled.
+        std::vector<std::pair<fcitx::InputContext *, CloudPinyinCallback>>
+            callbacks;
+    };
+    std::unordered_map<std::string, PendingRequest> pending_;
     CloudPinyinConfig config_;
     int errorCount_ = 0;
 };
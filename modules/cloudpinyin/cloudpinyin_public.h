@@ -32,6 +32,26 @@ using CloudPinyinSelectedCallback =
 FCITX_ADDON_DECLARE_FUNCTION(CloudPinyin, request,
                              void(const std::string &pinyin,
                                   CloudPinyinCallback));
+// Same as request, but the request can be cancelled by inputContext.
+FCITX_ADDON_DECLARE_FUNCTION(CloudPinyin, requestFor,
+                             void(fcitx::InputContext *inputContext,
+                                  const std::string &pinyin,
+                                  CloudPinyinCallback));
+// Cancel the pending requests of inputContext that are not a prefix of current
+// input. Their callbacks will not be called. The fetch keeps going if anyone
+// else is waiting for the same pinyin.
+FCITX_ADDON_DECLARE_FUNCTION(CloudPinyin, cancel,
+                             void(fcitx::InputContext *inputContext,
+                                  const std::string &input));
+// Fetch pinyin in background after a short delay, previous prefetch that is
+// not yet started is superseded. Return false if the result should be requested
+// directly, e.g. prefetch is disabled or the result is already available.
+// Otherwise callback is called once the result is fetched. The request can be
+// cancelled by inputContext.
+FCITX_ADDON_DECLARE_FUNCTION(CloudPinyin, prefetch,
+                             bool(fcitx::InputContext *inputContext,
+                                  const std::string &pinyin,
+                                  CloudPinyinCallback callback));
 FCITX_ADDON_DECLARE_FUNCTION(CloudPinyin, toggleKey, const fcitx::KeyList &());
 FCITX_ADDON_DECLARE_FUNCTION(CloudPinyin, resetError, void());
 
@@ -49,9 +69,10 @@ public:
           keep_(keep) {
         // use cloud unicode char
         setText(fcitx::Text("\xe2\x98\x81"));
-        cloudpinyin_->call<fcitx::ICloudPinyin::request>(
-            pinyin, [ref = watch()](const std::string &pinyin,
-                                    const std::string &hanzi) {
+        cloudpinyin_->call<fcitx::ICloudPinyin::requestFor>(
+            inputContext, pinyin,
+            [ref = watch()](const std::string &pinyin,
+                            const std::string &hanzi) {
                 FCITX_UNUSED(pinyin);
                 auto *self = ref.get();
                 if (self) {
@@ -0,0 +1,264 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+
+#include "diskcache.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <exception>
+#include <fcitx-utils/fdstreambuf.h>
+#include <fcitx-utils/fs.h>
+#include <fcitx-utils/log.h>
+#include <fcitx-utils/standardpaths.h>
+#include <fcitx-utils/stringutils.h>
+#include <fcitx-utils/unixfd.h>
+#include <fcntl.h>
+#include <future>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+using namespace fcitx;
+
+namespace {
+
+int64_t currentTime() { return static_cast<int64_t>(std::time(nullptr)); }
+
+bool isValidField(std::string_view value) {
+    return !value.empty() && value.find_first_of("\t\n") == std::string::npos;
+}
+
+bool isExpired(int64_t time, int64_t ttl, int64_t now) {
+    return time + ttl < now;
+}
+
+} // namespace
+
+CloudPinyinDiskCache::CloudPinyinDiskCache(std::string name, size_t maxSize,
+                                           int64_t ttl)
+    : path_(stringutils::concat("cloudpinyin/", name, ".cache")),
+      maxSize_(maxSize), ttl_(ttl) {}
+
+CloudPinyinDiskCache::~CloudPinyinDiskCache() {
+    if (saveFuture_.valid()) {
+        saveFuture_.wait();
+    }
+    // Write the entries inserted during the rewrite.
+    saving();
+}
+
+void CloudPinyinDiskCache::setLimit(size_t maxSize, int64_t ttl) {
+    maxSize_ = maxSize;
+    ttl_ = ttl;
+    if (loaded_ && !saving() && entries_.size() > maxSize_) {
+        compact();
+    }
+}
+
+bool CloudPinyinDiskCache::expired(const Entry &entry, int64_t now) const {
+    return isExpired(entry.time, ttl_, now);
+}
+
+const std::string *CloudPinyinDiskCache::find(const std::string &pinyin) {
+    if (!load()) {
+        return nullptr;
+    }
+    auto iter = entries_.find(pinyin);
+    if (iter == entries_.end()) {
+        return nullptr;
+    }
+    if (expired(iter->second, currentTime())) {
+        entries_.erase(iter);
+        return nullptr;
+    }
+    return &iter->second.hanzi;
+}
+
+void CloudPinyinDiskCache::insert(const std::string &pinyin,
+                                  const std::string &hanzi) {
+    if (maxSize_ == 0 || !isValidField(pinyin) || !isValidField(hanzi)) {
+        return;
+    }
+    const auto now = currentTime();
+    entries_[pinyin] = Entry{.hanzi = hanzi, .time = now};
+    if (load() && !saving() &&
+        (entries_.size() > maxSize_ || logSize_ >= maxSize_ * 2)) {
+        compact();
+        return;
+    }
+
+    auto line = stringutils::concat(now, "\t", pinyin, "\t", hanzi, "\n");
+    // Appending to the old file now would be lost after it is replaced.
+    if (saveFuture_.valid()) {
+        pendingLog_.append(line);
+        logSize_ += 1;
+        return;
+    }
+    if (appendLog(line)) {
+        logSize_ += 1;
+    }
+}
+
+bool CloudPinyinDiskCache::saving() {
+    if (!saveFuture_.valid()) {
+        return false;
+    }
+    if (saveFuture_.wait_for(std::chrono::seconds(0)) !=
+        std::future_status::ready) {
+        return true;
+    }
+    saveFuture_.get();
+    if (!pendingLog_.empty()) {
+        appendLog(pendingLog_);
+        pendingLog_.clear();
+    }
+    return false;
+}
+
+bool CloudPinyinDiskCache::appendLog(const std::string &lines) {
+    if (!log_.isValid()) {
+        log_ = StandardPaths::global().openUser(
+            StandardPathsType::PkgData, path_,
+            O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC);
+    }
+    if (!log_.isValid()) {
+        return false;
+    }
+    return fs::safeWrite(log_.fd(), lines.data(), lines.size()) ==
+           static_cast<ssize_t>(lines.size());
+}
+
+void CloudPinyinDiskCache::loadAsync() {
+    if (loaded_ || loadFuture_.valid()) {
+        return;
+    }
+
+    auto file = StandardPaths::global().openUser(StandardPathsType::PkgData,
+                                                 path_, O_RDONLY | O_CLOEXEC);
+    if (!file.isValid()) {
+        loaded_ = true;
+        return;
+    }
+    loadFuture_ = std::async(std::launch::async, &readLog, std::move(file),
+                             ttl_);
+}
+
+CloudPinyinDiskCache::LoadResult
+CloudPinyinDiskCache::readLog(UnixFD file, int64_t ttl) {
+    LoadResult result;
+    const auto now = currentTime();
+    try {
+        IFDStreamBuf buffer(file.fd());
+        std::istream in(&buffer);
+        std::string line;
+        while (std::getline(in, line)) {
+            result.logSize += 1;
+            auto tokens = stringutils::split(
+                line, "\t", stringutils::SplitBehavior::KeepEmpty);
+            if (tokens.size() != 3 || !isValidField(tokens[1]) ||
+                !isValidField(tokens[2])) {
+                result.needCompact = true;
+                continue;
+            }
+            Entry entry{.hanzi = std::move(tokens[2]), .time = 0};
+            try {
+                entry.time = std::stoll(tokens[0]);
+            } catch (const std::exception &) {
+                result.needCompact = true;
+                continue;
+            }
+            if (isExpired(entry.time, ttl, now)) {
+                result.needCompact = true;
+                continue;
+            }
+            // Later entry always wins.
+            result.entries[std::move(tokens[1])] = std::move(entry);
+        }
+    } catch (const std::exception &e) {
+        FCITX_WARN() << "Failed to load cloud pinyin cache: " << e.what();
+    }
+    return result;
+}
+
+bool CloudPinyinDiskCache::load() {
+    if (loaded_) {
+        return true;
+    }
+    loadAsync();
+    if (loaded_) {
+        return true;
+    }
+    if (loadFuture_.wait_for(std::chrono::seconds(0)) !=
+        std::future_status::ready) {
+        return false;
+    }
+    auto result = loadFuture_.get();
+    loaded_ = true;
+
+    // Entries inserted while loading are newer.
+    for (auto &[pinyin, entry] : result.entries) {
+        entries_.try_emplace(pinyin, std::move(entry));
+    }
+    logSize_ += result.logSize;
+    if (result.needCompact || entries_.size() > maxSize_ ||
+        logSize_ >= maxSize_ * 2) {
+        compact();
+    }
+    return true;
+}
+
+void CloudPinyinDiskCache::compact() {
+    const auto now = currentTime();
+    std::vector<std::pair<const std::string *, const Entry *>> items;
+    items.reserve(entries_.size());
+    for (const auto &[pinyin, entry] : entries_) {
+        if (!expired(entry, now)) {
+            items.emplace_back(&pinyin, &entry);
+        }
+    }
+    // Keep the most recent ones, and leave some room for new entries.
+    const size_t keepSize = maxSize_ - maxSize_ / 4;
+    if (items.size() > keepSize) {
+        std::ranges::nth_element(items, items.begin() + keepSize,
+                                 [](const auto &lhs, const auto &rhs) {
+                                     return lhs.second->time >
+                                            rhs.second->time;
+                                 });
+        items.resize(keepSize);
+    }
+    std::ranges::sort(items, [](const auto &lhs, const auto &rhs) {
+        return lhs.second->time < rhs.second->time;
+    });
+
+    std::string content;
+    for (const auto &[pinyin, entry] : items) {
+        content.append(stringutils::concat(entry->time, "\t", *pinyin, "\t",
+                                           entry->hanzi, "\n"));
+    }
+    std::unordered_map<std::string, Entry> entries;
+    for (const auto &[pinyin, entry] : items) {
+        entries.emplace(*pinyin, *entry);
+    }
+    entries_ = std::move(entries);
+    logSize_ = entries_.size();
+
+    log_.reset();
+    saveFuture_ = std::async(
+        std::launch::async, [path = path_, content = std::move(content)]() {
+            StandardPaths::global().safeSave(
+                StandardPathsType::PkgData, path, [&content](int fd) {
+                    return fs::safeWrite(fd, content.data(), content.size()) ==
+                           static_cast<ssize_t>(content.size());
+                });
+        });
+}
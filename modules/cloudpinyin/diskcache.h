@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#ifndef _CLOUDPINYIN_DISKCACHE_H_
+#define _CLOUDPINYIN_DISKCACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <fcitx-utils/unixfd.h>
+#include <future>
+#include <string>
+#include <unordered_map>
+
+// Persistent cache of cloud pinyin results for a single backend.
+//
+// Results are kept in an append-only log under
+// $XDG_DATA_HOME/fcitx5/cloudpinyin/<name>.cache, one "time\tpinyin\thanzi"
+// entry per line. The log is read in a separate thread after loadAsync(), and
+// lookups simply miss until it is ready. It is rewritten in a separate thread
+// when it grows too large or contains expired entries, and the rewrite only
+// keeps 3/4 of the limit, so it does not happen again on every insertion.
+class CloudPinyinDiskCache {
+public:
+    CloudPinyinDiskCache(std::string name, size_t maxSize, int64_t ttl);
+    ~CloudPinyinDiskCache();
+
+    void setLimit(size_t maxSize, int64_t ttl);
+    void loadAsync();
+
+    const std::string *find(const std::string &pinyin);
+    void insert(const std::string &pinyin, const std::string &hanzi);
+
+private:
+    struct Entry {
+        std::string hanzi;
+        int64_t time;
+    };
+
+    struct LoadResult {
+        std::unordered_map<std::string, Entry> entries;
+        size_t logSize = 0;
+        bool needCompact = false;
+    };
+
+    static LoadResult readLog(fcitx::UnixFD file, int64_t ttl);
+    // Merge the entries read from file if they are ready.
+    bool load();
+    void compact();
+    // Whether the file is being rewritten, entries inserted meanwhile are
+    // appended once it is done.
+    bool saving();
+    bool appendLog(const std::string &lines);
+    bool expired(const Entry &entry, int64_t now) const;
+
+    const std::string path_;
+    size_t maxSize_;
+    // In seconds.
+    int64_t ttl_;
+    bool loaded_ = false;
+    // Number of lines in the log, may include stale duplicates.
+    size_t logSize_ = 0;
+    std::unordered_map<std::string, Entry> entries_;
+    fcitx::UnixFD log_;
+    std::future<LoadResult> loadFuture_;
+    std::future<void> saveFuture_;
+    std::string pendingLog_;
+};
+
+#endif // _CLOUDPINYIN_DISKCACHE_H_
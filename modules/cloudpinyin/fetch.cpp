@@ -6,6 +6,7 @@
  */
 #include "fetch.h"
 #include "cloudpinyin.h"
+#include <algorithm>
 #include <cstdint>
 #include <curl/curl.h>
 #include <curl/multi.h>
@@ -17,8 +18,11 @@
 #include <fcntl.h>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <unistd.h>
+#include <utility>
+#include <vector>
 
 using namespace fcitx;
 
@@ -198,6 +202,7 @@ bool FetchThread::addRequest(const SetupRequestCallback &callback) {
     if (!queue || !callback(queue)) {
         return false;
     }
+    queue->setSerial(++serial_);
 
     {
         const std::lock_guard<std::mutex> lock(pendingQueueLock);
@@ -209,6 +214,28 @@ bool FetchThread::addRequest(const SetupRequestCallback &callback) {
     return true;
 }
 
+void FetchThread::cancelRequests(
+    std::vector<std::pair<CurlQueue *, uint64_t>> requests) {
+    dispatcher_.schedule([this, requests = std::move(requests)]() {
+        // Requests may still be in the pending queue.
+        handlePendingRequests();
+        std::vector<CurlQueue *> cancelled;
+        for (auto &queue : workingQueue) {
+            if (std::ranges::find(requests,
+                                  std::make_pair(&queue, queue.serial())) !=
+                requests.end()) {
+                cancelled.push_back(&queue);
+            }
+        }
+        for (auto *queue : cancelled) {
+            curl_multi_remove_handle(curlm_, queue->curl());
+            queue->cancel();
+            queue->remove();
+            finished(queue);
+        }
+    });
+}
+
 void FetchThread::exit() {
     dispatcher_.schedule([this]() {
         loop_->exit();
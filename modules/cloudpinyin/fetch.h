@@ -60,14 +60,17 @@ public:
         busy_ = false;
         data_.clear();
         pinyin_.clear();
-        // make sure lambda is free'd
-        callback_ = CloudPinyinCallback();
         httpCode_ = 0;
+        cancelled_ = false;
     }
 
     const auto &pinyin() const { return pinyin_; }
     void setPinyin(std::string pinyin) { pinyin_ = std::move(pinyin); }
 
+    // Identify the request, since the handle is reused after release.
+    uint64_t serial() const { return serial_; }
+    void setSerial(uint64_t serial) { serial_ = serial; }
+
     auto curl() { return curl_; }
     void finish(CURLcode result) {
         curlResult_ = result;
@@ -79,9 +82,11 @@ public:
 
     const std::vector<char> &result() { return data_; }
 
-    CloudPinyinCallback callback() { return callback_; }
-    void setCallback(CloudPinyinCallback callback) {
-        callback_ = std::move(callback);
+    bool cancelled() const { return cancelled_; }
+    void cancel() {
+        curlResult_ = CURLE_ABORTED_BY_CALLBACK;
+        httpCode_ = 0;
+        cancelled_ = true;
     }
 
     auto httpCode() const { return httpCode_; }
@@ -120,12 +125,13 @@ private:
     }
 
     bool busy_ = false;
+    bool cancelled_ = false;
     CURL *curl_ = nullptr;
     CURLcode curlResult_ = CURLE_OK;
     long httpCode_ = 0;
+    uint64_t serial_ = 0;
     std::vector<char> data_;
     std::string pinyin_;
-    CloudPinyinCallback callback_;
 };
 
 using SetupRequestCallback = std::function<bool(CurlQueue *)>;
@@ -137,6 +143,10 @@ public:
 
     // Call from main thread.
     bool addRequest(const SetupRequestCallback &callback);
+    // Abort the given requests, identified by the handle and its serial.
+    // They will still be returned by popFinished, but marked as cancelled.
+    void cancelRequests(
+        std::vector<std::pair<CurlQueue *, uint64_t>> requests);
     CurlQueue *popFinished();
 
 private:
@@ -175,6 +185,8 @@ private:
     CURLM *curlm_;
 
     CurlQueue handles_[MAX_HANDLE];
+    // Only accessed from main thread.
+    uint64_t serial_ = 0;
     fcitx::IntrusiveList<CurlQueue> pendingQueue;
     fcitx::IntrusiveList<CurlQueue> workingQueue;
     fcitx::IntrusiveList<CurlQueue> finishingQueue;
@@ -146,6 +146,13 @@ std::string PinyinHelper::reverseLookupStroke(const std::string &input) {
     return stroke_.reverseLookup(input);
 }
 
+std::string_view PinyinHelper::reverseLookupStrokeChar(uint32_t chr) {
+    if (!stroke_.load()) {
+        return {};
+    }
+    return stroke_.reverseLookup(chr);
+}
+
 std::string PinyinHelper::prettyStrokeString(const std::string &input) {
     if (!stroke_.load()) {
         return {};
@@ -29,6 +29,7 @@ public:
     std::vector<std::pair<std::string, std::string>>
     lookupStroke(const std::string &input, int limit);
     std::string reverseLookupStroke(const std::string &input);
+    std::string_view reverseLookupStrokeChar(uint32_t chr);
     std::string prettyStrokeString(const std::string &input);
     void loadStroke();
 
@@ -37,6 +38,7 @@ public:
     FCITX_ADDON_EXPORT_FUNCTION(PinyinHelper, lookupStroke);
     FCITX_ADDON_EXPORT_FUNCTION(PinyinHelper, loadStroke);
     FCITX_ADDON_EXPORT_FUNCTION(PinyinHelper, reverseLookupStroke);
+    FCITX_ADDON_EXPORT_FUNCTION(PinyinHelper, reverseLookupStrokeChar);
     FCITX_ADDON_EXPORT_FUNCTION(PinyinHelper, prettyStrokeString);
 
     FCITX_ADDON_DEPENDENCY_LOADER(quickphrase, instance_->addonManager());
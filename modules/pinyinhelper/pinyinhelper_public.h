@@ -7,8 +7,10 @@
 #ifndef _PINYINHELPER_PINYINHELPER_PUBLIC_H_
 #define _PINYINHELPER_PINYINHELPER_PUBLIC_H_
 
+#include <cstdint>
 #include <fcitx/addoninstance.h>
 #include <string>
+#include <string_view>
 #include <vector>
 
 FCITX_ADDON_DECLARE_FUNCTION(PinyinHelper, lookup,
@@ -17,11 +19,16 @@ FCITX_ADDON_DECLARE_FUNCTION(PinyinHelper, lookup,
 FCITX_ADDON_DECLARE_FUNCTION(
     PinyinHelper, fullLookup,
     std::vector<std::tuple<std::string, std::string, int>>(uint32_t));
+/* negative limit means unlimited, 0 only returns the exact match */
 FCITX_ADDON_DECLARE_FUNCTION(PinyinHelper, lookupStroke,
                              std::vector<std::pair<std::string, std::string>>(
                                  const std::string &, int limit));
 FCITX_ADDON_DECLARE_FUNCTION(PinyinHelper, reverseLookupStroke,
                              std::string(const std::string &));
+/* return the stroke of a single character without allocation, empty if it is
+ * unknown or ambiguous. The view is valid as long as the addon. */
+FCITX_ADDON_DECLARE_FUNCTION(PinyinHelper, reverseLookupStrokeChar,
+                             std::string_view(uint32_t));
 FCITX_ADDON_DECLARE_FUNCTION(PinyinHelper, prettyStrokeString,
                              std::string(const std::string &));
 FCITX_ADDON_DECLARE_FUNCTION(PinyinHelper, loadStroke, void());
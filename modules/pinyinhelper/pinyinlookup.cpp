@@ -6,20 +6,22 @@
  *
  */
 #include "pinyinlookup.h"
+#include "../../common/mappedfile.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <fcitx-utils/cutf8.h>
-#include <fcitx-utils/fs.h>
 #include <fcitx-utils/log.h>
 #include <fcitx-utils/macros.h>
 #include <fcitx-utils/standardpaths.h>
 #include <fcitx-utils/stringutils.h>
 #include <fcitx-utils/utf8.h>
-#include <fcntl.h>
+#include <span>
 #include <string>
 #include <string_view>
 #include <tuple>
-#include <unistd.h>
+#include <utility>
 #include <vector>
 
 namespace fcitx {
@@ -91,15 +93,27 @@ std::string_view py_enhance_get_konsonant(int index) {
 }
 } // namespace
 
-std::vector<std::string> PinyinLookup::lookup(uint32_t hz) {
-    auto iter = data_.find(hz);
-    if (iter == data_.end()) {
+std::string_view PinyinLookup::consonant(const PinyinLookupData &data) {
+    return py_enhance_get_konsonant(data.consonant);
+}
+
+std::string_view PinyinLookup::vocal(const PinyinLookupData &data, int tone) {
+    return py_enhance_get_vokal(data.vocal, tone);
+}
+
+std::span<const PinyinLookupData> PinyinLookup::lookupData(uint32_t hz) const {
+    auto iter = std::ranges::lower_bound(index_, hz, {}, &Index::hz);
+    if (iter == index_.end() || iter->hz != hz) {
         return {};
     }
+    return std::span(data_).subspan(iter->offset, iter->count);
+}
+
+std::vector<std::string> PinyinLookup::lookup(uint32_t hz) {
     std::vector<std::string> result;
-    for (const auto &data : iter->second) {
-        auto c = py_enhance_get_konsonant(data.consonant);
-        auto v = py_enhance_get_vokal(data.vocal, data.tone);
+    for (const auto &data : lookupData(hz)) {
+        auto c = consonant(data);
+        auto v = vocal(data, data.tone);
         if (c.empty() && v.empty()) {
             continue;
         }
@@ -110,18 +124,14 @@ std::vector<std::string> PinyinLookup::lookup(uint32_t hz) {
 
 std::vector<std::tuple<std::string, std::string, int>>
 PinyinLookup::fullLookup(uint32_t hz) {
-    auto iter = data_.find(hz);
-    if (iter == data_.end()) {
-        return {};
-    }
     std::vector<std::tuple<std::string, std::string, int>> result;
-    for (const auto &data : iter->second) {
-        auto c = py_enhance_get_konsonant(data.consonant);
-        auto v = py_enhance_get_vokal(data.vocal, data.tone);
+    for (const auto &data : lookupData(hz)) {
+        auto c = consonant(data);
+        auto v = vocal(data, data.tone);
         if (c.empty() && v.empty()) {
             continue;
         }
-        auto noToneV = py_enhance_get_vokal(data.vocal, 0);
+        auto noToneV = vocal(data, 0);
         result.emplace_back(stringutils::concat(c, v),
                             stringutils::concat(c, noToneV), data.tone);
     }
@@ -136,9 +146,12 @@ bool PinyinLookup::load() {
 
     auto file = StandardPaths::global().open(StandardPathsType::PkgData,
                                              "pinyinhelper/py_table.mb");
-    if (!file.isValid()) {
+    // Read the whole file at once, instead of a few bytes per read().
+    MappedFile mapped(file.fd());
+    if (!mapped.isValid()) {
         return false;
     }
+    mapped.adviseSequential();
     /**
      * Format:
      * uint8_t word_l;
@@ -146,40 +159,43 @@ bool PinyinLookup::load() {
      * uint8_t count;
      * int8_t py[count][3];
      **/
-    while (true) {
-        char word[FCITX_UTF8_MAX_LENGTH + 1];
-        uint8_t wordLen;
-        auto res = fs::safeRead(file.fd(), &wordLen, 1);
-        if (res == 0) {
-            break;
-        }
-        if (res < 0 || wordLen > FCITX_UTF8_MAX_LENGTH) {
-            return false;
-        }
-        if (read(file.fd(), word, wordLen) != wordLen) {
+    const auto *cur = reinterpret_cast<const uint8_t *>(mapped.data());
+    const auto *end = cur + mapped.size();
+    // The same character may appear more than once.
+    std::vector<std::pair<uint32_t, PinyinLookupData>> entries;
+    while (cur != end) {
+        const uint8_t wordLen = *cur++;
+        if (wordLen > FCITX_UTF8_MAX_LENGTH ||
+            static_cast<size_t>(end - cur) < wordLen + 1U) {
             return false;
         }
-        word[wordLen] = '\0';
-        std::string_view view(word);
+        std::string_view view(reinterpret_cast<const char *>(cur), wordLen);
+        cur += wordLen;
         if (utf8::lengthValidated(view) != 1) {
             return false;
         }
         uint32_t chr = utf8::getChar(view);
-        uint8_t count;
-        if (read(file.fd(), &count, 1) != 1) {
+        const uint8_t count = *cur++;
+        if (static_cast<size_t>(end - cur) < count * 3U) {
             return false;
         }
-        if (count == 0) {
-            continue;
+        for (uint8_t i = 0; i < count; i++, cur += 3) {
+            entries.emplace_back(chr, PinyinLookupData{cur[0], cur[1], cur[2]});
         }
-        auto &data = data_[chr];
-        while (count--) {
-            uint8_t buf[3];
-            if (read(file.fd(), buf, 3) != 3) {
-                return false;
-            }
-            data.push_back({buf[0], buf[1], buf[2]});
+    }
+
+    // Keep the file order of readings of the same character.
+    std::ranges::stable_sort(entries, {},
+                             &std::pair<uint32_t, PinyinLookupData>::first);
+    data_.reserve(entries.size());
+    for (const auto &[chr, data] : entries) {
+        if (index_.empty() || index_.back().hz != chr) {
+            index_.push_back(Index{.hz = chr,
+                                   .offset = static_cast<uint32_t>(data_.size()),
+                                   .count = 0});
         }
+        index_.back().count += 1;
+        data_.push_back(data);
     }
     loadResult_ = true;
     return true;
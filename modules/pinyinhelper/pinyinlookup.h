@@ -8,9 +8,10 @@
 #define _PINYINHELPER_PINYINLOOKUP_H_
 
 #include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
 #include <tuple>
-#include <unordered_map>
 #include <vector>
 
 namespace fcitx {
@@ -27,9 +28,24 @@ public:
     std::vector<std::string> lookup(uint32_t hz);
     std::vector<std::tuple<std::string, std::string, int>>
     fullLookup(uint32_t hz);
+    // Readings of hz without allocation, the span is valid as long as
+    // PinyinLookup. Use consonant() and vocal() to get the string.
+    std::span<const PinyinLookupData> lookupData(uint32_t hz) const;
+
+    static std::string_view consonant(const PinyinLookupData &data);
+    // Vocal with tone mark, or without if tone is 0.
+    static std::string_view vocal(const PinyinLookupData &data, int tone);
 
 private:
-    std::unordered_map<uint32_t, std::vector<PinyinLookupData>> data_;
+    struct Index {
+        uint32_t hz;
+        uint32_t offset;
+        uint32_t count;
+    };
+
+    // Sorted by hz, each one refers to a range of data_.
+    std::vector<Index> index_;
+    std::vector<PinyinLookupData> data_;
     bool loaded_ = false;
     bool loadResult_ = false;
 };
@@ -6,10 +6,15 @@
  *
  */
 #include "stroke.h"
+#include "../../common/mappedfile.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <exception>
 #include <fcitx-utils/fdstreambuf.h>
+#include <fcitx-utils/fs.h>
 #include <fcitx-utils/macros.h>
 #include <fcitx-utils/standardpaths.h>
 #include <fcitx-utils/stringutils.h>
@@ -20,11 +25,13 @@
 #include <istream>
 #include <libime/core/datrie.h>
 #include <optional>
-#include <queue>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <tuple>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -33,60 +40,199 @@ namespace fcitx {
 
 Stroke::Stroke() {}
 
+namespace {
+
+constexpr std::string_view CacheMagic = "FCST";
+// Bump when the layout or the content of cache changes.
+constexpr uint32_t CacheVersion = 1;
+constexpr char CachePath[] = "fcitx5/pinyinhelper/py_stroke.cache";
+
+// Written in native byte order, a cache from other architecture will fail the
+// version check and be regenerated.
+struct CacheHeader {
+    char magic[4];
+    uint32_t version;
+    // Source file that cache is generated from.
+    int64_t sourceMTimeSec;
+    int64_t sourceMTimeNSec;
+    uint64_t sourceSize;
+    uint32_t indexSize;
+    uint32_t strokesSize;
+    uint32_t trieSize;
+    uint32_t padding;
+};
+
+bool sameSource(const CacheHeader &header, const struct stat &source) {
+    return header.sourceMTimeSec == source.st_mtim.tv_sec &&
+           header.sourceMTimeNSec == source.st_mtim.tv_nsec &&
+           header.sourceSize == static_cast<uint64_t>(source.st_size);
+}
+
+} // namespace
+
 void Stroke::loadAsync() {
     if (loadFuture_.valid()) {
         return;
     }
 
     loadFuture_ = std::async(std::launch::async, []() {
-        std::tuple<libime::DATrie<int32_t>, libime::DATrie<int32_t>> result;
-        auto &dict = std::get<0>(result);
-        auto &reverseDict = std::get<1>(result);
-
         auto file = StandardPaths::global().open(StandardPathsType::PkgData,
                                                  "pinyinhelper/py_stroke.mb");
         if (!file.isValid()) {
             throw std::runtime_error("Failed to open file");
         }
 
+        struct stat source;
+        const bool hasSource = fstat(file.fd(), &source) == 0;
+        if (hasSource) {
+            if (auto result = loadCache(source)) {
+                return std::move(*result);
+            }
+        }
+
         IFDStreamBuf buffer(file.fd());
         std::istream in(&buffer);
-        std::string buf;
-        while (!in.eof()) {
-            if (!std::getline(in, buf)) {
-                break;
-            }
-            // Validate everything first, so it's easier to process.
-            if (!utf8::validate(buf)) {
-                continue;
-            }
+        auto result = loadText(in);
+        if (hasSource) {
+            saveCache(result, source);
+        }
+        return result;
+    });
+}
 
-            auto line = stringutils::trimView(buf);
-            if (line.empty() || line[0] == '#') {
-                continue;
-            }
-            auto pos = line.find_first_of(FCITX_WHITESPACE);
-            if (pos == std::string::npos) {
-                continue;
-            }
-            std::string_view key = line.substr(0, pos);
-            std::string_view value =
-                stringutils::trimView(line.substr(pos + 1));
-            if (utf8::length(value) != 1 ||
-                key.find_first_not_of("12345") != std::string::npos) {
-                continue;
-            }
-            std::string token = stringutils::concat(key, "|", value);
-            std::string reverseToken = stringutils::concat(value, "|", key);
-            dict.set(token, 1);
-            reverseDict.set(reverseToken, 1);
+Stroke::StrokeData Stroke::loadText(std::istream &in) {
+    StrokeData result;
+    auto &dict = result.dict;
+    // Empty string means the character has more than one stroke.
+    std::unordered_map<uint32_t, std::string> reverseMap;
+
+    std::string buf;
+    while (!in.eof()) {
+        if (!std::getline(in, buf)) {
+            break;
+        }
+        // Validate everything first, so it's easier to process.
+        if (!utf8::validate(buf)) {
+            continue;
         }
 
-        dict.shrink_tail();
-        reverseDict.shrink_tail();
+        auto line = stringutils::trimView(buf);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        auto pos = line.find_first_of(FCITX_WHITESPACE);
+        if (pos == std::string::npos) {
+            continue;
+        }
+        std::string_view key = line.substr(0, pos);
+        std::string_view value = stringutils::trimView(line.substr(pos + 1));
+        if (utf8::length(value) != 1 ||
+            key.find_first_not_of("12345") != std::string::npos) {
+            continue;
+        }
+        std::string token = stringutils::concat(key, "|", value);
+        dict.set(token, 1);
+        auto [iter, inserted] =
+            reverseMap.try_emplace(utf8::getChar(value), key);
+        if (!inserted && iter->second != key) {
+            iter->second.clear();
+        }
+    }
 
-        return result;
-    });
+    dict.shrink_tail();
+
+    result.index.reserve(reverseMap.size());
+    for (const auto &[chr, stroke] : reverseMap) {
+        if (stroke.empty()) {
+            continue;
+        }
+        result.index.push_back(StrokeIndex{
+            .chr = chr,
+            .offset = static_cast<uint32_t>(result.strokes.size()),
+            .length = static_cast<uint32_t>(stroke.size())});
+        result.strokes.append(stroke);
+    }
+    std::ranges::sort(result.index, {}, &StrokeIndex::chr);
+
+    return result;
+}
+
+std::optional<Stroke::StrokeData>
+Stroke::loadCache(const struct stat &source) {
+    auto fd = StandardPaths::global().openUser(StandardPathsType::Cache,
+                                               CachePath, O_RDONLY | O_CLOEXEC);
+    MappedFile file(fd.fd());
+    if (!file.isValid()) {
+        return std::nullopt;
+    }
+    auto data = file.view();
+    CacheHeader header;
+    if (data.size() < sizeof(header)) {
+        return std::nullopt;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    const size_t indexBytes =
+        static_cast<size_t>(header.indexSize) * sizeof(StrokeIndex);
+    if (std::string_view(header.magic, sizeof(header.magic)) != CacheMagic ||
+        header.version != CacheVersion || !sameSource(header, source) ||
+        data.size() != sizeof(header) + indexBytes + header.strokesSize +
+                           header.trieSize) {
+        return std::nullopt;
+    }
+    data.remove_prefix(sizeof(header));
+
+    StrokeData result;
+    result.index.resize(header.indexSize);
+    std::memcpy(result.index.data(), data.data(), indexBytes);
+    data.remove_prefix(indexBytes);
+    result.strokes.assign(data.substr(0, header.strokesSize));
+    data.remove_prefix(header.strokesSize);
+    for (const auto &index : result.index) {
+        if (static_cast<size_t>(index.offset) + index.length >
+            result.strokes.size()) {
+            return std::nullopt;
+        }
+    }
+    try {
+        MappedFileStreamBuf buffer(data);
+        std::istream in(&buffer);
+        result.dict.load(in);
+    } catch (const std::exception &) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+void Stroke::saveCache(StrokeData &data, const struct stat &source) {
+    std::ostringstream trie;
+    try {
+        data.dict.save(trie);
+    } catch (const std::exception &) {
+        return;
+    }
+    const auto trieData = trie.str();
+
+    CacheHeader header{};
+    std::memcpy(header.magic, CacheMagic.data(), sizeof(header.magic));
+    header.version = CacheVersion;
+    header.sourceMTimeSec = source.st_mtim.tv_sec;
+    header.sourceMTimeNSec = source.st_mtim.tv_nsec;
+    header.sourceSize = source.st_size;
+    header.indexSize = data.index.size();
+    header.strokesSize = data.strokes.size();
+    header.trieSize = trieData.size();
+
+    std::string content(reinterpret_cast<const char *>(&header),
+                        sizeof(header));
+    content.append(reinterpret_cast<const char *>(data.index.data()),
+                   data.index.size() * sizeof(StrokeIndex));
+    content.append(data.strokes);
+    content.append(trieData);
+    StandardPaths::global().safeSave(
+        StandardPathsType::Cache, CachePath, [&content](int fd) {
+            return fs::safeWrite(fd, content.data(), content.size()) ==
+                   static_cast<ssize_t>(content.size());
+        });
 }
 
 bool Stroke::load() {
@@ -97,7 +243,10 @@ bool Stroke::load() {
         loadAsync();
     }
     try {
-        std::tie(dict_, revserseDict_) = loadFuture_.get();
+        auto result = loadFuture_.get();
+        dict_ = std::move(result.dict);
+        index_ = std::move(result.index);
+        strokes_ = std::move(result.strokes);
         loadResult_ = true;
     } catch (...) {
         loadResult_ = false;
@@ -112,34 +261,61 @@ bool Stroke::load() {
 #define SUBSTITUTION_WEIGHT 5
 #define TRANSPOSITION_WEIGHT 5
 
+#define MAX_WEIGHT 10
+
 std::vector<std::pair<std::string, std::string>>
 Stroke::lookup(std::string_view input, int limit) {
     std::vector<std::pair<std::string, std::string>> result;
-    std::unordered_set<std::string> resultSet;
-    using position_type = decltype(dict_)::position_type;
-    struct LookupItem {
-        position_type pos;
-        std::string_view remain;
-        int weight;
-        int length;
-
-        bool operator>(const LookupItem &other) const {
-            return weight > other.weight;
-        }
+    for (const auto &[hanzi, stroke] : lookupView(input, limit)) {
+        result.emplace_back(hanzi, stroke);
+    }
+    return result;
+}
+
+const std::vector<std::pair<std::string_view, std::string_view>> &
+Stroke::lookupView(std::string_view input, int limit) {
+    lookupResults_.clear();
+    lookupAdded_.clear();
+    lookupBuffer_.clear();
+    lookupViews_.clear();
+    search(input, limit);
+    // Buffer is not changed any more, so it's safe to create views now.
+    for (const auto &result : lookupResults_) {
+        std::string_view key(lookupBuffer_.data() + result.offset,
+                             result.length);
+        lookupViews_.emplace_back(key.substr(result.strokeLength + 1),
+                                  key.substr(0, result.strokeLength));
+    }
+    return lookupViews_;
+}
+
+void Stroke::addLookupResult(size_t length, TrieType::position_type pos) {
+    dict_.suffix(lookupKey_, length, pos);
+    auto separator = lookupKey_.find_last_of('|');
+    if (separator == std::string::npos) {
+        return;
+    }
+    // Same entry may be reached with different edits. Results are unlimited
+    // when limit is negative, so linear search is not good enough.
+    if (!lookupAdded_.insert(lookupKey_).second) {
+        return;
+    }
+    lookupResults_.push_back(LookupResult{.offset = lookupBuffer_.size(),
+                                          .strokeLength = separator,
+                                          .length = lookupKey_.size()});
+    lookupBuffer_.append(lookupKey_);
+}
+
+void Stroke::search(std::string_view input, int limit) {
+    // Negative limit means unlimited, while 0 still gives the exact match.
+    const auto limitReached = [this, limit]() {
+        return limit >= 0 &&
+               lookupResults_.size() >= static_cast<size_t>(limit);
     };
-    std::priority_queue<LookupItem, std::vector<LookupItem>,
-                        std::greater<LookupItem>>
-        q;
 
     // First lets check if the stroke is already a prefix of single word.
-    std::optional<position_type> onlyMatch;
+    std::optional<TrieType::position_type> onlyMatch;
     size_t onlyMatchLength = 0;
-    auto addResult = [&result, &resultSet](std::string stroke, std::string hz) {
-        if (resultSet.insert(hz).second) {
-            result.emplace_back(std::move(stroke), std::move(hz));
-        }
-    };
-
     if (dict_.foreach(input, [&onlyMatch, &onlyMatchLength](int32_t, size_t len,
                                                             uint64_t pos) {
             if (onlyMatch) {
@@ -150,50 +326,57 @@ Stroke::lookup(std::string_view input, int limit) {
             return true;
         })) {
         if (onlyMatch) {
-            std::string buf;
-            dict_.suffix(buf, input.size() + onlyMatchLength, *onlyMatch);
-            if (auto idx = buf.find_last_of('|'); idx != std::string::npos) {
-                addResult(buf.substr(idx + 1), buf.substr(0, idx));
-            }
+            addLookupResult(input.size() + onlyMatchLength, *onlyMatch);
         }
     }
-    if (result.size() >= static_cast<size_t>(limit)) {
-        return result;
+    if (limitReached()) {
+        return;
     }
 
-    auto pushQueue = [&q](LookupItem &&item) {
-        if (item.weight >= 10) {
+    // Best first search, items are popped in the order of weight, so the first
+    // time a state is popped is always the cheapest one.
+    lookupQueue_.clear();
+    lookupVisited_.clear();
+    auto pushQueue = [this](LookupItem item) {
+        if (item.weight >= MAX_WEIGHT) {
             return;
         }
-        q.push(item);
+        lookupQueue_.push_back(item);
+        std::ranges::push_heap(lookupQueue_, std::greater<LookupItem>());
     };
 
-    pushQueue(LookupItem{.pos = 0, .remain = input, .weight = 0, .length = 0});
-
-    while (!q.empty()) {
-        auto current = q.top();
-        q.pop();
-        if (current.remain.empty()) {
-            if (!dict_.foreach(
-                    "|",
-                    [this, &result, &current, limit,
-                     &addResult](int32_t, size_t len, uint64_t pos) {
-                        std::string buf;
-                        dict_.suffix(buf, current.length + 1 + len, pos);
-                        addResult(buf.substr(current.length + 1),
-                                  buf.substr(0, current.length));
-                        return limit <= 0 ||
-                               result.size() < static_cast<size_t>(limit);
-                    },
-                    current.pos)) {
+    pushQueue(LookupItem{.pos = 0, .offset = 0, .weight = 0, .length = 0});
+
+    while (!lookupQueue_.empty()) {
+        std::ranges::pop_heap(lookupQueue_, std::greater<LookupItem>());
+        const auto current = lookupQueue_.back();
+        lookupQueue_.pop_back();
+        if (!lookupVisited_
+                 .insert(LookupState{.pos = current.pos,
+                                     .offset = current.offset})
+                 .second) {
+            continue;
+        }
+        const auto remain = input.substr(current.offset);
+        if (remain.empty()) {
+            dict_.foreach(
+                "|",
+                [this, &current, &limitReached](int32_t, size_t len,
+                                                 uint64_t pos) {
+                    addLookupResult(current.length + 1 + len, pos);
+                    return !limitReached();
+                },
+                current.pos);
+            // Nothing popped later can be better.
+            if (limitReached()) {
                 break;
             }
         }
 
         // Deletion
-        if (!current.remain.empty()) {
+        if (!remain.empty()) {
             pushQueue(LookupItem{.pos = current.pos,
-                                 .remain = current.remain.substr(1),
+                                 .offset = current.offset + 1,
                                  .weight = current.weight + DELETION_WEIGHT,
                                  .length = current.length});
         }
@@ -201,74 +384,57 @@ Stroke::lookup(std::string_view input, int limit) {
         for (char i = '1'; i <= '5'; i++) {
             auto pos = current.pos;
             auto v = dict_.traverse(&i, 1, pos);
-            if (libime::DATrie<int32_t>::isNoPath(v)) {
+            if (TrieType::isNoPath(v)) {
                 continue;
             }
-            if (!current.remain.empty() && current.remain[0] == i) {
+            if (!remain.empty() && remain[0] == i) {
                 pushQueue(LookupItem{.pos = pos,
-                                     .remain = current.remain.substr(1),
+                                     .offset = current.offset + 1,
                                      .weight = current.weight,
                                      .length = current.length + 1});
             } else {
                 pushQueue(
                     LookupItem{.pos = pos,
-                               .remain = current.remain,
+                               .offset = current.offset,
                                .weight = current.weight + INSERTION_WEIGHT,
                                .length = current.length + 1});
-                if (!current.remain.empty()) {
+                if (!remain.empty()) {
                     pushQueue(LookupItem{.pos = pos,
-                                         .remain = current.remain.substr(1),
+                                         .offset = current.offset + 1,
                                          .weight = current.weight +
                                                    SUBSTITUTION_WEIGHT,
                                          .length = current.length + 1});
                 }
             }
 
-            if (current.remain.size() >= 2 && current.remain[1] == i) {
+            if (remain.size() >= 2 && remain[1] == i) {
                 auto nextPos = pos;
-                auto nextV = dict_.traverse(current.remain.data(), 1, nextPos);
-                if (!libime::DATrie<int32_t>::isNoPath(nextV)) {
-                    pushQueue(LookupItem{nextPos, current.remain.substr(2),
-                                         current.weight + TRANSPOSITION_WEIGHT,
-                                         current.length + 2});
+                auto nextV = dict_.traverse(remain.data(), 1, nextPos);
+                if (!TrieType::isNoPath(nextV)) {
+                    pushQueue(LookupItem{
+                        .pos = nextPos,
+                        .offset = current.offset + 2,
+                        .weight = current.weight + TRANSPOSITION_WEIGHT,
+                        .length = current.length + 2});
                 }
             }
         }
     }
-
-    return result;
 }
 
 std::string Stroke::reverseLookup(const std::string &hanzi) const {
-    using position_type = decltype(dict_)::position_type;
-    libime::DATrie<int32_t>::position_type pos = 0;
-    auto result = revserseDict_.traverse(hanzi, pos);
-    if (libime::DATrie<int32_t>::isNoPath(result)) {
+    if (utf8::lengthValidated(hanzi) != 1) {
         return {};
     }
-    result = revserseDict_.traverse("|", pos);
-    if (libime::DATrie<int32_t>::isNoPath(result)) {
+    return std::string(reverseLookup(utf8::getChar(hanzi)));
+}
+
+std::string_view Stroke::reverseLookup(uint32_t chr) const {
+    auto iter = std::ranges::lower_bound(index_, chr, {}, &StrokeIndex::chr);
+    if (iter == index_.end() || iter->chr != chr) {
         return {};
     }
-    std::optional<position_type> onlyMatch;
-    size_t onlyMatchLength = 0;
-    if (revserseDict_.foreach(
-            [&onlyMatch, &onlyMatchLength](int32_t, size_t len, uint64_t pos) {
-                if (onlyMatch) {
-                    return false;
-                }
-                onlyMatch = pos;
-                onlyMatchLength = len;
-                return true;
-            },
-            pos)) {
-        if (onlyMatch) {
-            std::string buf;
-            revserseDict_.suffix(buf, onlyMatchLength, *onlyMatch);
-            return buf;
-        }
-    }
-    return {};
+    return std::string_view(strokes_).substr(iter->offset, iter->length);
 }
 
 std::string Stroke::prettyString(const std::string &input) const {
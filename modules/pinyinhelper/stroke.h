@@ -7,12 +7,19 @@
 #ifndef _PINYINHELPER_STROKE_H_
 #define _PINYINHELPER_STROKE_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <future>
+#include <istream>
 #include <libime/core/datrie.h>
+#include <optional>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <sys/stat.h>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace fcitx {
 
@@ -24,17 +31,89 @@ public:
     bool load();
     std::vector<std::pair<std::string, std::string>>
     lookup(std::string_view input, int limit);
+    // Same as lookup, but results are pairs of (hanzi, stroke) views into a
+    // buffer owned by Stroke, which is only valid until next lookup.
+    const std::vector<std::pair<std::string_view, std::string_view>> &
+    lookupView(std::string_view input, int limit);
     std::string prettyString(const std::string &input) const;
     std::string reverseLookup(const std::string &hanzi) const;
+    // Return the stroke of chr, or empty if it is unknown or has more than one
+    // stroke. The returned view is valid as long as Stroke.
+    std::string_view reverseLookup(uint32_t chr) const;
 
 private:
-    libime::DATrie<int32_t> dict_;
-    libime::DATrie<int32_t> revserseDict_;
+    using TrieType = libime::DATrie<int32_t>;
+
+    struct StrokeIndex {
+        uint32_t chr;
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    struct StrokeData {
+        TrieType dict;
+        // Sorted by chr, strokes are stored in strokes.
+        std::vector<StrokeIndex> index;
+        std::string strokes;
+    };
+
+    struct LookupItem {
+        TrieType::position_type pos;
+        // Offset of remaining input.
+        uint32_t offset;
+        int weight;
+        int length;
+
+        bool operator>(const LookupItem &other) const {
+            return weight > other.weight;
+        }
+    };
+
+    struct LookupState {
+        TrieType::position_type pos;
+        uint32_t offset;
+
+        bool operator==(const LookupState &other) const = default;
+    };
+
+    struct LookupStateHash {
+        size_t operator()(const LookupState &state) const {
+            return std::hash<uint64_t>()(state.pos * 31 + state.offset);
+        }
+    };
+
+    // A "stroke|hanzi" key in lookupBuffer_.
+    struct LookupResult {
+        size_t offset;
+        size_t strokeLength;
+        size_t length;
+    };
+
+    void search(std::string_view input, int limit);
+    void addLookupResult(size_t length, TrieType::position_type pos);
+
+    static StrokeData loadText(std::istream &in);
+    // Binary cache of the parsed py_stroke.mb under user cache directory, so
+    // the text file is only parsed when it changes.
+    static std::optional<StrokeData> loadCache(const struct stat &source);
+    static void saveCache(StrokeData &data, const struct stat &source);
+
+    TrieType dict_;
+    std::vector<StrokeIndex> index_;
+    std::string strokes_;
     bool loaded_ = false;
     bool loadResult_ = false;
 
-    std::future<std::tuple<libime::DATrie<int32_t>, libime::DATrie<int32_t>>>
-        loadFuture_;
+    std::future<StrokeData> loadFuture_;
+
+    // Reused by lookupView to avoid allocation.
+    std::vector<LookupItem> lookupQueue_;
+    std::unordered_set<LookupState, LookupStateHash> lookupVisited_;
+    std::vector<LookupResult> lookupResults_;
+    std::unordered_set<std::string> lookupAdded_;
+    std::string lookupBuffer_;
+    std::string lookupKey_;
+    std::vector<std::pair<std::string_view, std::string_view>> lookupViews_;
 };
 } // namespace fcitx
 
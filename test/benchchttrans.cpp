@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+
+// Compare the throughput and load time of chttrans backends on a text corpus.
+//
+// Usage: benchchttrans [-t] [-n rounds] corpus
+//
+// Each line of corpus is converted separately, from simplified to traditional
+// by default, or the reverse with -t. Phrase dictionaries are located the same
+// way as the addon, so XDG_DATA_DIRS may need to include the build directory.
+
+#include "../modules/chttrans/chttrans-native.h"
+#include "../modules/chttrans/chttrans-phrase.h"
+#include "../modules/chttrans/chttrans.h"
+#include "config.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fcitx-utils/eventdispatcher.h>
+#include <fstream>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef ENABLE_OPENCC
+#include "../modules/chttrans/chttrans-opencc.h"
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+}
+
+void run(const char *name, ChttransBackend &backend,
+         const std::function<bool()> &load,
+         const std::vector<std::string> &lines, size_t bytes, int rounds,
+         ChttransIMType type) {
+    auto start = Clock::now();
+    if (!load()) {
+        std::cout << name << ": failed to load" << std::endl;
+        return;
+    }
+    const auto loadTime = elapsedMs(start);
+
+    size_t outputBytes = 0;
+    start = Clock::now();
+    for (int i = 0; i < rounds; i++) {
+        // Only measure the conversion.
+        backend.clearCache();
+        for (const auto &line : lines) {
+            outputBytes += type == ChttransIMType::Trad
+                               ? backend.convertSimpToTrad(line).size()
+                               : backend.convertTradToSimp(line).size();
+        }
+    }
+    const auto convertTime = elapsedMs(start);
+    // Cache is cleared every round, so hits only come from repeated lines.
+    const auto &stats = backend.cacheStats();
+    const auto lookups = stats.hit + stats.miss;
+    std::cout << name << ": load " << loadTime << " ms, "
+              << static_cast<double>(bytes) * rounds / 1000 / convertTime
+              << " MB/s, " << outputBytes / rounds << " bytes output, "
+              << (lookups ? 100.0 * stats.hit / lookups : 0.0)
+              << "% cache hit" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    auto type = ChttransIMType::Trad;
+    int rounds = 5;
+    int c;
+    while ((c = getopt(argc, argv, "tn:h")) != EOF) {
+        switch (c) {
+        case 't':
+            type = ChttransIMType::Simp;
+            break;
+        case 'n':
+            rounds = std::max(1, std::atoi(optarg));
+            break;
+        case 'h':
+        default:
+            std::cerr << "Usage: " << argv[0] << " [-t] [-n rounds] corpus"
+                      << std::endl;
+            return c == 'h' ? 0 : 1;
+        }
+    }
+    if (optind + 1 != argc) {
+        std::cerr << "Usage: " << argv[0] << " [-t] [-n rounds] corpus"
+                  << std::endl;
+        return 1;
+    }
+
+    std::ifstream in(argv[optind]);
+    if (!in) {
+        std::cerr << "Failed to open " << argv[optind] << std::endl;
+        return 1;
+    }
+    std::vector<std::string> lines;
+    size_t bytes = 0;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty()) {
+            bytes += line.size();
+            lines.push_back(std::move(line));
+        }
+    }
+
+    ChttransConfig config;
+    NativeBackend native;
+    run(
+        "Native", native, [&]() { return native.load(config); }, lines, bytes,
+        rounds, type);
+    PhraseBackend phrase;
+    run(
+        "Phrase", phrase, [&]() { return phrase.load(config); }, lines, bytes,
+        rounds, type);
+#ifdef ENABLE_OPENCC
+    fcitx::EventDispatcher dispatcher;
+    OpenCCBackend opencc(&dispatcher);
+    run(
+        "OpenCC", opencc,
+        [&]() {
+            // Profile is loaded in background, wait for it.
+            if (!opencc.load(config)) {
+                return false;
+            }
+            const auto deadline = Clock::now() + std::chrono::seconds(10);
+            while (!opencc.prepare(type)) {
+                if (Clock::now() > deadline) {
+                    return false;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return true;
+        },
+        lines, bytes, rounds, type);
+#endif
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+
+// Compare FlatCache against LRUCache with the access pattern of cloud pinyin:
+// string keys from a skewed distribution, lookup first and insert on miss.
+//
+// Usage: benchflatcache [-n operations] [-c capacity]
+
+#include "../common/flatcache.h"
+#include "../modules/cloudpinyin/lrucache.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <getopt.h>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::string> generateKeys(size_t operations, size_t capacity) {
+    // Working set is larger than the cache, so eviction is exercised.
+    std::vector<std::string> keySpace;
+    for (size_t i = 0; i < capacity * 4; i++) {
+        keySpace.push_back("pinyin" + std::to_string(i * 2654435761U));
+    }
+    std::mt19937 rng(0);
+    // Approximate the zipf like distribution of typed pinyin.
+    std::geometric_distribution<size_t> dist(4.0 / keySpace.size());
+    std::vector<std::string> keys;
+    keys.reserve(operations);
+    for (size_t i = 0; i < operations; i++) {
+        keys.push_back(keySpace[dist(rng) % keySpace.size()]);
+    }
+    return keys;
+}
+
+template <typename Cache>
+void run(const char *name, Cache &cache, const std::vector<std::string> &keys) {
+    size_t hit = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto &key : keys) {
+        if (auto *value = cache.find(key)) {
+            hit += value->size() != 0;
+        } else {
+            cache.insert(key, key);
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << name << ": "
+              << static_cast<double>(elapsed.count()) / keys.size()
+              << " ns/op, hit rate "
+              << static_cast<double>(hit) / keys.size() << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    size_t operations = 1000000;
+    size_t capacity = 2048;
+    int c;
+    while ((c = getopt(argc, argv, "n:c:h")) != EOF) {
+        switch (c) {
+        case 'n':
+            operations = std::max(1, std::atoi(optarg));
+            break;
+        case 'c':
+            capacity = std::max(1, std::atoi(optarg));
+            break;
+        case 'h':
+        default:
+            std::cerr << "Usage: " << argv[0]
+                      << " [-n operations] [-c capacity]" << std::endl;
+            return c == 'h' ? 0 : 1;
+        }
+    }
+
+    auto keys = generateKeys(operations, capacity);
+    LRUCache<std::string, std::string> lru(capacity);
+    run("LRUCache", lru, keys);
+    fcitx::FlatCache<std::string, std::string> flat(capacity);
+    run("FlatCache", flat, keys);
+    return 0;
+}
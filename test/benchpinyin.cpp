@@ -0,0 +1,330 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+
+// Replay keystroke corpora through the pinyin engine via testfrontend and
+// report per key latency percentiles as JSON.
+//
+// Usage: benchpinyin [-n rounds] [corpus file...]
+//
+// A corpus file contains one session per line. The first word of a line is
+// the input method name (pinyin or shuangpin), the rest are key strings that
+// can be parsed by fcitx::Key, e.g. "pinyin n i h a o BackSpace o space".
+// Empty lines and lines starting with '#' are ignored. Input context is reset
+// after each session.
+
+#include "../im/pinyin/pinyin_public.h"
+#include "testdir.h"
+#include "testfrontend_public.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fcitx-utils/event.h>
+#include <fcitx-utils/eventdispatcher.h>
+#include <fcitx-utils/key.h>
+#include <fcitx-utils/log.h>
+#include <fcitx-utils/macros.h>
+#include <fcitx-utils/standardpaths.h>
+#include <fcitx-utils/stringutils.h>
+#include <fcitx-utils/testing.h>
+#include <fcitx/addonmanager.h>
+#include <fcitx/candidatelist.h>
+#include <fcitx/event.h>
+#include <fcitx/inputcontext.h>
+#include <fcitx/inputcontextmanager.h>
+#include <fcitx/inputmethodgroup.h>
+#include <fcitx/inputmethodmanager.h>
+#include <fcitx/inputpanel.h>
+#include <fcitx/instance.h>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace fcitx;
+
+namespace {
+
+struct Session {
+    std::string im;
+    std::vector<Key> keys;
+};
+
+// Built-in corpus, used when no corpus file is given.
+constexpr std::string_view defaultCorpus[] = {
+    // Full pinyin, long sentence with nbest candidates.
+    "pinyin w o m e n d o u s h i z h o n g g u o r e n space",
+    "pinyin z h e g e w e n t i h e n n a n j i e j u e 1",
+    "pinyin n i h a o s h i j i e Return",
+    "pinyin x i a n z a i j i d i a n l e space",
+    "pinyin s h u r u f a d e x i n g n e n g h e n z h o n g y a o space",
+    // Full pinyin with backspace editing.
+    "pinyin z h o n g h u a r e n m i n BackSpace BackSpace BackSpace "
+    "BackSpace BackSpace g o n g h e g u o space",
+    "pinyin b e i j i n g d a x u e BackSpace BackSpace BackSpace x u e "
+    "space",
+    // Full pinyin mixed with punctuation.
+    "pinyin n i h a o comma w o s h i space period",
+    "pinyin t a s h u o colon space quotedbl h a o space quotedbl",
+    "pinyin w e i s h e n m e question space exclam",
+    // Paging through candidate list.
+    "pinyin s h i equal equal equal minus space",
+    // Shuangpin.
+    "shuangpin u i h k space",
+    "shuangpin w o m f d z u i o s g d r f space",
+    "shuangpin v s v s v s v s BackSpace BackSpace space comma",
+    "shuangpin i u r u f a space period",
+};
+
+std::vector<Session> parseCorpus(std::istream &in) {
+    std::vector<Session> sessions;
+    std::string line;
+    while (std::getline(in, line)) {
+        auto trimmed = stringutils::trimView(line);
+        if (trimmed.empty() || trimmed.front() == '#') {
+            continue;
+        }
+        auto tokens = stringutils::split(trimmed, FCITX_WHITESPACE);
+        if (tokens.size() < 2) {
+            continue;
+        }
+        Session session;
+        session.im = tokens[0];
+        for (size_t i = 1; i < tokens.size(); i++) {
+            Key key(tokens[i]);
+            if (!key.isValid()) {
+                std::cerr << "Invalid key: " << tokens[i] << std::endl;
+                continue;
+            }
+            session.keys.push_back(key);
+        }
+        sessions.push_back(std::move(session));
+    }
+    return sessions;
+}
+
+class LatencySeries {
+public:
+    void add(std::chrono::nanoseconds duration) {
+        samples_.push_back(duration.count());
+    }
+
+    std::string toJson() {
+        std::sort(samples_.begin(), samples_.end());
+        uint64_t total = 0;
+        for (auto sample : samples_) {
+            total += sample;
+        }
+        return std::format(
+            R"({{"count": {}, "mean_us": {:.3f}, "p50_us": {:.3f}, )"
+            R"("p99_us": {:.3f}, "p999_us": {:.3f}, "max_us": {:.3f}}})",
+            samples_.size(),
+            samples_.empty() ? 0.0
+                             : static_cast<double>(total) / samples_.size() /
+                                   1000.0,
+            percentile(0.5), percentile(0.99), percentile(0.999),
+            samples_.empty() ? 0.0 : samples_.back() / 1000.0);
+    }
+
+private:
+    double percentile(double p) const {
+        if (samples_.empty()) {
+            return 0;
+        }
+        // Nearest rank.
+        auto rank = static_cast<size_t>(std::ceil(p * samples_.size()));
+        rank = std::clamp<size_t>(rank, 1, samples_.size());
+        return samples_[rank - 1] / 1000.0;
+    }
+
+    std::vector<int64_t> samples_;
+};
+
+struct BenchResult {
+    // Keys that only update the preedit and candidate list.
+    LatencySeries updateUI;
+    // Walking the visible page of the candidate list, like a UI would do.
+    LatencySeries candidateList;
+    // Keys that result in a commit.
+    LatencySeries commit;
+};
+
+void renderCandidateList(InputContext *ic, size_t &sink) {
+    auto candidateList = ic->inputPanel().candidateList();
+    if (!candidateList) {
+        return;
+    }
+    for (int i = 0; i < candidateList->size(); i++) {
+        sink += candidateList->candidate(i).text().toString().size();
+        sink += candidateList->label(i).toString().size();
+    }
+    if (auto *pageable = candidateList->toPageable()) {
+        sink += pageable->hasNext();
+        sink += pageable->hasPrev();
+    }
+}
+
+void runBench(Instance *instance, const std::vector<Session> &sessions,
+              int rounds) {
+    auto *testfrontend = instance->addonManager().addon("testfrontend");
+    auto uuid =
+        testfrontend->call<ITestFrontend::createInputContext>("benchpinyin");
+    auto *ic = instance->inputContextManager().findByUUID(uuid);
+    FCITX_ASSERT(ic);
+
+    bool committed = false;
+    auto commitWatcher = instance->watchEvent(
+        EventType::InputContextCommitString, EventWatcherPhase::PreInputMethod,
+        [&committed](Event &) { committed = true; });
+
+    BenchResult result;
+    size_t totalKeys = 0;
+    size_t sink = 0;
+    auto benchStart = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (const auto &session : sessions) {
+            instance->setCurrentInputMethod(ic, session.im, true);
+            for (const auto &key : session.keys) {
+                committed = false;
+                auto start = std::chrono::steady_clock::now();
+                testfrontend->call<ITestFrontend::keyEvent>(uuid, key, false);
+                auto keyDone = std::chrono::steady_clock::now();
+                renderCandidateList(ic, sink);
+                auto renderDone = std::chrono::steady_clock::now();
+                testfrontend->call<ITestFrontend::keyEvent>(uuid, key, true);
+
+                auto keyLatency = keyDone - start;
+                if (committed) {
+                    result.commit.add(keyLatency);
+                } else {
+                    result.updateUI.add(keyLatency);
+                }
+                result.candidateList.add(renderDone - keyDone);
+                totalKeys++;
+            }
+            ic->reset();
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - benchStart);
+
+    std::cout << std::format(
+                     R"({{"benchmark": "pinyin-keyevent", "rounds": {}, )"
+                     R"("sessions": {}, "keys": {}, "elapsed_ms": {}, )",
+                     rounds, sessions.size(), totalKeys, elapsed.count())
+              << R"("updateUI": )" << result.updateUI.toJson()
+              << R"(, "candidateList": )" << result.candidateList.toJson()
+              << R"(, "commit": )" << result.commit.toJson() << "}"
+              << std::endl;
+    // Keep the candidate walk observable.
+    if (sink == 0) {
+        std::cerr << "No candidate was produced." << std::endl;
+    }
+}
+
+// In microseconds.
+constexpr uint64_t DictionaryPollInterval = 10000;
+
+std::unique_ptr<EventSourceTime> endBenchEvent;
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    int rounds = 10;
+    int c;
+    while ((c = getopt(argc, argv, "n:h")) != EOF) {
+        switch (c) {
+        case 'n':
+            rounds = std::max(1, std::atoi(optarg));
+            break;
+        case 'h':
+        default:
+            std::cerr << "Usage: " << argv[0] << " [-n rounds] [corpus...]"
+                      << std::endl;
+            return c == 'h' ? 0 : 1;
+        }
+    }
+
+    std::vector<Session> sessions;
+    if (optind < argc) {
+        for (int i = optind; i < argc; i++) {
+            std::ifstream in(argv[i]);
+            if (!in) {
+                std::cerr << "Failed to open corpus: " << argv[i] << std::endl;
+                return 1;
+            }
+            auto fileSessions = parseCorpus(in);
+            std::move(fileSessions.begin(), fileSessions.end(),
+                      std::back_inserter(sessions));
+        }
+    } else {
+        for (auto line : defaultCorpus) {
+            std::istringstream in{std::string(line)};
+            auto lineSessions = parseCorpus(in);
+            std::move(lineSessions.begin(), lineSessions.end(),
+                      std::back_inserter(sessions));
+        }
+    }
+
+    setupTestingEnvironment(
+        TESTING_BINARY_DIR, {"bin"},
+        {TESTING_BINARY_DIR "/test", TESTING_BINARY_DIR "/im",
+         TESTING_BINARY_DIR "/modules", TESTING_SOURCE_DIR "/modules",
+         StandardPaths::fcitxPath("pkgdatadir")});
+    // Only keep errors, so the output stays machine readable.
+    fcitx::Log::setLogRule("default=2");
+    char arg0[] = "benchpinyin";
+    char arg1[] = "--disable=all";
+    char arg2[] = "--enable=testim,testfrontend,pinyin,punctuation,"
+                  "pinyinhelper,spell";
+    char *instanceArgv[] = {arg0, arg1, arg2};
+    Instance instance(FCITX_ARRAY_SIZE(instanceArgv), instanceArgv);
+    instance.addonManager().registerDefaultLoader(nullptr);
+    instance.eventDispatcher().schedule([&instance]() {
+        auto *pinyin = instance.addonManager().addon("pinyin", true);
+        FCITX_ASSERT(pinyin);
+        auto defaultGroup = instance.inputMethodManager().currentGroup();
+        defaultGroup.inputMethodList().clear();
+        defaultGroup.inputMethodList().push_back(
+            InputMethodGroupItem("keyboard-us"));
+        defaultGroup.inputMethodList().push_back(
+            InputMethodGroupItem("pinyin"));
+        defaultGroup.inputMethodList().push_back(
+            InputMethodGroupItem("shuangpin"));
+        defaultGroup.setDefaultInputMethod("");
+        instance.inputMethodManager().setGroup(std::move(defaultGroup));
+    });
+    instance.eventDispatcher().schedule([&instance, &sessions, rounds]() {
+        // Wait for the dictionaries loaded by worker thread.
+        endBenchEvent = instance.eventLoop().addTimeEvent(
+            CLOCK_MONOTONIC, now(CLOCK_MONOTONIC), 0,
+            [&instance, &sessions, rounds](EventSourceTime *source,
+                                           uint64_t) {
+                auto *pinyin = instance.addonManager().addon("pinyin");
+                if (!pinyin->call<IPinyinEngine::dictionaryLoaded>()) {
+                    source->setNextInterval(DictionaryPollInterval);
+                    source->setOneShot();
+                    return true;
+                }
+                runBench(&instance, sessions, rounds);
+                instance.exit();
+                return true;
+            });
+    });
+    instance.exec();
+    endBenchEvent.reset();
+    return 0;
+}
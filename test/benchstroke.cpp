@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+
+// Measure Stroke::lookupView over random stroke strings, grouped by input
+// length. Limit is chosen the same way as the pinyin engine unless -l is given.
+//
+// Usage: benchstroke [-n lookups] [-m max length] [-l limit]
+
+#include "../modules/pinyinhelper/stroke.h"
+#include "testdir.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fcitx-utils/testing.h>
+#include <getopt.h>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char *argv[]) {
+    size_t lookups = 100000;
+    size_t maxLength = 12;
+    int fixedLimit = 0;
+    int c;
+    while ((c = getopt(argc, argv, "n:m:l:h")) != EOF) {
+        switch (c) {
+        case 'n':
+            lookups = std::max(1, std::atoi(optarg));
+            break;
+        case 'm':
+            maxLength = std::max(1, std::atoi(optarg));
+            break;
+        case 'l':
+            fixedLimit = std::max(1, std::atoi(optarg));
+            break;
+        case 'h':
+        default:
+            std::cerr << "Usage: " << argv[0]
+                      << " [-n lookups] [-m max length] [-l limit]"
+                      << std::endl;
+            return c == 'h' ? 0 : 1;
+        }
+    }
+
+    fcitx::setupTestingEnvironmentPath(TESTING_BINARY_DIR, {"bin"},
+                                       {TESTING_BINARY_DIR "/modules"});
+    fcitx::Stroke stroke;
+    auto start = std::chrono::steady_clock::now();
+    if (!stroke.load()) {
+        std::cerr << "Failed to load stroke data." << std::endl;
+        return 1;
+    }
+    std::cout << "load: "
+              << std::chrono::duration<double, std::milli>(
+                     std::chrono::steady_clock::now() - start)
+                     .count()
+              << " ms" << std::endl;
+
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<size_t> lengthDist(1, maxLength);
+    std::uniform_int_distribution<int> strokeDist('1', '5');
+    std::vector<double> totalNs(maxLength + 1);
+    std::vector<size_t> count(maxLength + 1);
+    size_t results = 0;
+    std::string input;
+    for (size_t i = 0; i < lookups; i++) {
+        const auto length = lengthDist(rng);
+        input.clear();
+        for (size_t j = 0; j < length; j++) {
+            input.push_back(static_cast<char>(strokeDist(rng)));
+        }
+        const int limit =
+            fixedLimit ? fixedLimit
+                       : std::min(static_cast<int>((length + 4) / 5), 3);
+        start = std::chrono::steady_clock::now();
+        results += stroke.lookupView(input, limit).size();
+        totalNs[length] += std::chrono::duration<double, std::nano>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+        count[length] += 1;
+    }
+
+    for (size_t length = 1; length <= maxLength; length++) {
+        if (count[length]) {
+            std::cout << "length " << length << ": "
+                      << totalNs[length] / count[length] << " ns/lookup"
+                      << std::endl;
+        }
+    }
+    std::cout << "results: " << results << std::endl;
+    return 0;
+}
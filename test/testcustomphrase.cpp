@@ -3,6 +3,7 @@
 #include <fstream>
 #include <sstream>
 #include <string_view>
+#include <sys/stat.h>
 
 using namespace fcitx;
 
@@ -52,6 +53,41 @@ void test_basic() {
     FCITX_ASSERT((*result)[0].value() == "ABC");
 }
 
+void test_snapshot() {
+    std::stringstream ss;
+    ss << testInput;
+
+    CustomPhraseDict dict;
+    dict.load(ss, true);
+    std::stringstream expected;
+    dict.save(expected);
+
+    struct stat source{};
+    source.st_size = testInput.size();
+    source.st_mtim.tv_sec = 1234;
+    std::stringstream snapshot;
+    FCITX_ASSERT(dict.saveSnapshot(snapshot, source));
+    const std::string data = snapshot.str();
+
+    CustomPhraseDict loaded;
+    FCITX_ASSERT(loaded.loadSnapshot(data, source));
+    std::stringstream output;
+    loaded.save(output);
+    FCITX_ASSERT(output.str() == expected.str()) << output.str();
+    auto *result = loaded.lookup("zzz");
+    FCITX_ASSERT(result);
+    FCITX_ASSERT(result->size() == 1);
+    FCITX_ASSERT((*result)[0].value() == (*dict.lookup("zzz"))[0].value());
+
+    // Stale or truncated snapshot is rejected and dict is left untouched.
+    auto modified = source;
+    modified.st_mtim.tv_nsec = 1;
+    FCITX_ASSERT(!loaded.loadSnapshot(data, modified));
+    FCITX_ASSERT(!loaded.loadSnapshot(
+        std::string_view(data).substr(0, data.size() - 1), source));
+    FCITX_ASSERT(loaded.lookup("zzz"));
+}
+
 void test_evaluator() {
     CustomPhrase phrase(0, "a");
     auto evaluator = [](std::string_view name) -> std::string {
@@ -63,45 +99,45 @@ void test_evaluator() {
         return "";
     };
 
-    phrase.mutableValue() = "$a $b";
+    phrase.setValue("$a $b");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "$a $b");
 
-    phrase.mutableValue() = "#$a $b";
+    phrase.setValue("#$a $b");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "xx yy")
         << phrase.evaluate(evaluator);
 
-    phrase.mutableValue() = "#$a$b";
+    phrase.setValue("#$a$b");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "xxyy");
 
-    phrase.mutableValue() = "#$a*$b";
+    phrase.setValue("#$a*$b");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "xx*yy");
 
-    phrase.mutableValue() = "#$a_$b";
+    phrase.setValue("#$a_$b");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "yy");
 
-    phrase.mutableValue() = "#$a$$b";
+    phrase.setValue("#$a$$b");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "xx$b");
 
-    phrase.mutableValue() = "#$a$$";
+    phrase.setValue("#$a$$");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "xx$");
 
-    phrase.mutableValue() = "#${a} $b";
+    phrase.setValue("#${a} $b");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "xx yy");
 
-    phrase.mutableValue() = "#${a}${b}";
+    phrase.setValue("#${a}${b}");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "xxyy");
 
-    phrase.mutableValue() = "#$}${b}";
+    phrase.setValue("#$}${b}");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "$}yy");
 
-    phrase.mutableValue() = "#$ ${b}";
+    phrase.setValue("#$ ${b}");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "$ yy");
 
-    phrase.mutableValue() = "#$a$";
+    phrase.setValue("#$a$");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "xx$")
         << phrase.evaluate(evaluator);
 
-    phrase.mutableValue() = "#$a${b";
+    phrase.setValue("#$a${b");
     FCITX_ASSERT(phrase.evaluate(evaluator) == "xx${b");
 }
 
@@ -131,10 +167,20 @@ void test_builtin_evaluator() {
     FCITX_ASSERT(CustomPhrase::builtinEvaluator("ampm_cn") == "下午");
     FCITX_ASSERT(CustomPhrase::builtinEvaluator("minute_cn") == "十六");
     FCITX_ASSERT(CustomPhrase::builtinEvaluator("second_cn") == "零六");
+
+    const auto time = CustomPhrase::currentTime();
+    CustomPhrase phrase(1, "#${year}-${month_mm}-${day_dd} ${fullhour}:$a");
+    auto evaluator = [](std::string_view name) -> std::string {
+        FCITX_ASSERT(name == "a") << name;
+        return "xx";
+    };
+    FCITX_ASSERT(phrase.evaluate(time, evaluator) == "2023-07-11 23:xx")
+        << phrase.evaluate(time, evaluator);
 }
 
 int main() {
     test_basic();
+    test_snapshot();
     test_evaluator();
     test_builtin_evaluator();
     return 0;
@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#include "../common/flatcache.h"
+#include <cstddef>
+#include <fcitx-utils/log.h>
+#include <string>
+
+using namespace fcitx;
+
+void test_basic() {
+    FlatCache<std::string, std::string> cache(3);
+    FCITX_ASSERT(cache.empty());
+    FCITX_ASSERT(cache.capacity() == 3);
+
+    FCITX_ASSERT(cache.insert("a", "1"));
+    FCITX_ASSERT(cache.insert("b", "2"));
+    FCITX_ASSERT(!cache.insert("a", "3"));
+    FCITX_ASSERT(cache.size() == 2);
+    FCITX_ASSERT(*cache.find("a") == "1");
+    FCITX_ASSERT(!cache.find("c"));
+
+    cache.erase("a");
+    FCITX_ASSERT(!cache.contains("a"));
+    FCITX_ASSERT(cache.contains("b"));
+    FCITX_ASSERT(cache.size() == 1);
+
+    cache.clear();
+    FCITX_ASSERT(cache.empty());
+    FCITX_ASSERT(!cache.find("b"));
+}
+
+void test_evict() {
+    FlatCache<int, int> cache(4);
+    for (int i = 0; i < 4; i++) {
+        cache.insert(i, i * 10);
+    }
+    // Recently used entry gets a second chance.
+    FCITX_ASSERT(cache.find(0));
+    cache.insert(4, 40);
+    FCITX_ASSERT(cache.size() == 4);
+    FCITX_ASSERT(cache.contains(0));
+    FCITX_ASSERT(!cache.contains(1));
+    FCITX_ASSERT(*cache.find(4) == 40);
+
+    // Size never exceeds capacity, and all remaining entries are reachable.
+    for (int i = 5; i < 1000; i++) {
+        cache.insert(i, i * 10);
+        if (i % 3 == 0) {
+            cache.erase(i - 1);
+        }
+        FCITX_ASSERT(cache.size() <= cache.capacity());
+        FCITX_ASSERT(*cache.find(i) == i * 10);
+    }
+    size_t found = 0;
+    for (int i = 0; i < 1000; i++) {
+        if (auto *value = cache.find(i)) {
+            FCITX_ASSERT(*value == i * 10);
+            found++;
+        }
+    }
+    FCITX_ASSERT(found == cache.size());
+}
+
+int main() {
+    test_basic();
+    test_evict();
+    return 0;
+}
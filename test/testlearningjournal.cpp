@@ -0,0 +1,217 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2024 CSSlayer <wengxt@gmail.com>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ */
+#include "../im/pinyin/learningjournal.h"
+#include "testdir.h"
+#include <cstdlib>
+#include <fcitx-utils/log.h>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <libime/core/historybigram.h>
+#include <libime/core/languagemodel.h>
+#include <libime/core/userlanguagemodel.h>
+#include <libime/pinyin/pinyindictionary.h>
+#include <libime/pinyin/pinyinencoder.h>
+#include <libime/pinyin/pinyinime.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace fcitx;
+
+const std::string dataDir = TESTING_BINARY_DIR "/test/learningjournal";
+const std::string historyFile = dataDir + "/fcitx5/pinyin/user.history";
+const std::string journalFile = dataDir + "/fcitx5/pinyin/user.journal";
+
+std::unique_ptr<libime::PinyinIME> createIME() {
+    return std::make_unique<libime::PinyinIME>(
+        std::make_unique<libime::PinyinDictionary>(),
+        std::make_unique<libime::UserLanguageModel>(
+            libime::DefaultLanguageModelResolver::instance()
+                .languageModelFileForLanguage("zh_CN")));
+}
+
+// Stamp of the journal depends on the size of user.history, so every version
+// written by the test has a different size.
+void writeHistory(std::string_view content) {
+    std::ofstream out(historyFile, std::ios::out | std::ios::trunc);
+    out << content;
+}
+
+void appendJournal(std::string_view content) {
+    std::ofstream out(journalFile, std::ios::out | std::ios::app);
+    out << content;
+}
+
+bool hasUserWord(libime::PinyinIME *ime, std::string_view hanzi) {
+    std::stringstream ss;
+    ime->dict()->save(libime::PinyinDictionary::UserDict, ss,
+                      libime::PinyinDictFormat::Text);
+    return ss.str().find(hanzi) != std::string::npos;
+}
+
+libime::HistoryBigram::WordWithCode word(std::string_view hanzi,
+                                         std::string_view pinyin) {
+    auto code = libime::PinyinEncoder::encodeFullPinyin(pinyin);
+    return {std::string(hanzi), std::string(code.data(), code.size())};
+}
+
+void test_replay() {
+    writeHistory("a");
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        journal.addWord("ni'hao", "你好");
+        journal.addWord("zhong'guo", "中国");
+        journal.removeWord("zhong'guo", "中国");
+        journal.addHistory(
+            {word("你好", "ni'hao"), word("世界", "shi'jie")});
+        journal.forget("世界");
+        FCITX_ASSERT(!journal.needCompact());
+    }
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        FCITX_ASSERT(!journal.needCompact());
+        FCITX_ASSERT(hasUserWord(ime.get(), "你好"));
+        FCITX_ASSERT(!hasUserWord(ime.get(), "中国"));
+        FCITX_ASSERT(!ime->model()->history().isUnknown("你好"));
+        FCITX_ASSERT(ime->model()->history().isUnknown("世界"));
+
+        journal.clearUserDict();
+        journal.clearHistory();
+    }
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        FCITX_ASSERT(!journal.needCompact());
+        FCITX_ASSERT(!hasUserWord(ime.get(), "你好"));
+        FCITX_ASSERT(ime->model()->history().isUnknown("你好"));
+    }
+}
+
+void test_stale() {
+    writeHistory("ab");
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        journal.reset();
+        journal.addWord("ni'hao", "你好");
+    }
+    // user.history is replaced without resetting the journal, e.g. crashed
+    // right after compaction.
+    writeHistory("abc");
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        FCITX_ASSERT(!hasUserWord(ime.get(), "你好"));
+        journal.addWord("shi'jie", "世界");
+    }
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        FCITX_ASSERT(!hasUserWord(ime.get(), "你好"));
+        FCITX_ASSERT(hasUserWord(ime.get(), "世界"));
+    }
+}
+
+void test_truncated() {
+    writeHistory("abcd");
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        journal.reset();
+        journal.addWord("ni'hao", "你好");
+    }
+    // Crashed when writing the last record.
+    appendJournal("W\tshi'jie\t世");
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        FCITX_ASSERT(!journal.needCompact());
+        FCITX_ASSERT(hasUserWord(ime.get(), "你好"));
+        FCITX_ASSERT(!hasUserWord(ime.get(), "世"));
+        journal.addWord("zhong'guo", "中国");
+    }
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        FCITX_ASSERT(!journal.needCompact());
+        FCITX_ASSERT(hasUserWord(ime.get(), "你好"));
+        FCITX_ASSERT(hasUserWord(ime.get(), "中国"));
+        FCITX_ASSERT(!hasUserWord(ime.get(), "世"));
+    }
+}
+
+void test_checkpoint() {
+    writeHistory("abcde");
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        journal.reset();
+        journal.addWord("ni'hao", "你好");
+        auto checkpoint = journal.checkpoint();
+        journal.addWord("shi'jie", "世界");
+        // Snapshot taken at checkpoint is saved.
+        writeHistory("abcdef");
+        journal.reset(checkpoint);
+        journal.addWord("zhong'guo", "中国");
+    }
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        FCITX_ASSERT(!hasUserWord(ime.get(), "你好"));
+        FCITX_ASSERT(hasUserWord(ime.get(), "世界"));
+        FCITX_ASSERT(hasUserWord(ime.get(), "中国"));
+    }
+
+    // Journal is created after the checkpoint.
+    std::filesystem::remove(journalFile);
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        auto checkpoint = journal.checkpoint();
+        journal.addWord("ni'hao", "你好");
+        writeHistory("abcdefg");
+        journal.reset(checkpoint);
+    }
+    {
+        auto ime = createIME();
+        LearningJournal journal;
+        journal.load(ime.get());
+        FCITX_ASSERT(!journal.needCompact());
+        FCITX_ASSERT(hasUserWord(ime.get(), "你好"));
+    }
+}
+
+int main() {
+    setenv("XDG_DATA_HOME", dataDir.data(), 1);
+    std::filesystem::create_directories(dataDir + "/fcitx5/pinyin");
+    std::filesystem::remove(journalFile);
+
+    test_replay();
+    test_stale();
+    test_truncated();
+    test_checkpoint();
+
+    std::filesystem::remove_all(dataDir);
+    return 0;
+}
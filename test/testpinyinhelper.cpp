@@ -41,6 +41,9 @@ int main() {
     auto result4 =
         pinyinhelper->call<fcitx::IPinyinHelper::reverseLookupStroke>("你");
     FCITX_ASSERT(result4 == "3235234") << result4;
+    FCITX_ASSERT(
+        pinyinhelper->call<fcitx::IPinyinHelper::reverseLookupStrokeChar>(
+            fcitx::utf8::getChar("你")) == result4);
     auto result5 =
         pinyinhelper->call<fcitx::IPinyinHelper::prettyStrokeString>("54321");
     FCITX_ASSERT(result5 == "𠃍㇏丿丨一");